@@ -28,6 +28,10 @@
 #include <atk-bridge.h>
 #include "eail.h"
 #include "eail_app.h"
+#include "eail_factory.h"
+#include "eail_events.h"
+#include "eail_item_parent.h"
+#include "eail_utils.h"
 #include "eail_priv.h"
 
 /**
@@ -81,6 +85,269 @@ static AtkObject * eail_get_root(void)
    return root;
 }
 
+/**
+ * @brief Magic bytes starting serialized tree snapshot
+ */
+#define EAIL_TREE_SNAPSHOT_MAGIC "EAIL"
+
+/**
+ * @brief Version of serialized tree snapshot format
+ */
+#define EAIL_TREE_SNAPSHOT_VERSION 1
+
+/**
+ * @brief Size of serialized header: magic, version, node count, names size
+ */
+#define EAIL_TREE_SNAPSHOT_HEADER_SIZE 16
+
+/**
+ * @brief Size of serialized Eail_Tree_Node
+ */
+#define EAIL_TREE_SNAPSHOT_NODE_SIZE 44
+
+/**
+ * @brief Fills snapshot node with data of given accessible
+ *
+ * @param node an Eail_Tree_Node
+ * @param obj an AtkObject
+ * @param names buffer collecting names
+ */
+static void
+_eail_tree_node_fill(Eail_Tree_Node *node, AtkObject *obj, Eina_Strbuf *names)
+{
+   AtkStateSet *state_set;
+   const gchar *name;
+   int state;
+
+   node->role = atk_object_get_role(obj);
+
+   name = atk_object_get_name(obj);
+   if (name && name[0])
+     {
+        node->name = eina_strbuf_length_get(names);
+        eina_strbuf_append_length(names, name, strlen(name) + 1);
+     }
+   else
+     node->name = 0;
+
+   node->states = 0;
+   state_set = atk_object_ref_state_set(obj);
+   if (state_set)
+     {
+        for (state = 0; state < ATK_STATE_LAST_DEFINED && state < 64; ++state)
+          if (atk_state_set_contains_state(state_set, state))
+            node->states |= 1ULL << state;
+        g_object_unref(state_set);
+     }
+
+   node->x = node->y = 0;
+   node->width = node->height = -1;
+   if (ATK_IS_COMPONENT(obj))
+     atk_component_get_extents(ATK_COMPONENT(obj), &node->x, &node->y,
+                               &node->width, &node->height, ATK_XY_WINDOW);
+}
+
+/**
+ * Tree is walked once in breadth-first order, every accessible is queried
+ * only for data stored in its node. Accessible met twice in the tree is
+ * stored only once.
+ *
+ * @param win window to take snapshot of
+ *
+ * @return newly allocated Eail_Tree_Snapshot or NULL on failure. Should be
+ * freed with eail_tree_snapshot_free
+ */
+EAPI Eail_Tree_Snapshot *
+eail_tree_snapshot(Evas_Object *win)
+{
+   Eail_Tree_Snapshot *snapshot;
+   Eina_Inarray *nodes;
+   Eina_Array *objects;
+   Eina_Hash *visited;
+   Eina_Strbuf *names;
+   Eail_Tree_Node node, *parent;
+   AtkObject *obj, *child;
+   unsigned int i;
+   gint j, n;
+
+   obj = eail_factory_get_accessible(win);
+   if (!obj) return NULL;
+
+   snapshot = calloc(1, sizeof(Eail_Tree_Snapshot));
+   if (!snapshot) return NULL;
+
+   nodes = eina_inarray_new(sizeof(Eail_Tree_Node), 64);
+   objects = eina_array_new(64);
+   visited = eina_hash_pointer_new(NULL);
+   names = eina_strbuf_new();
+   /* offset 0 is the empty name */
+   eina_strbuf_append_length(names, "", 1);
+
+   memset(&node, 0, sizeof(node));
+   node.parent = EAIL_TREE_NO_PARENT;
+   _eail_tree_node_fill(&node, obj, names);
+   eina_inarray_push(nodes, &node);
+   eina_array_push(objects, g_object_ref(obj));
+   eina_hash_add(visited, &obj, obj);
+
+   /* nodes pushed while walking are appended behind the current one */
+   for (i = 0; i < eina_array_count(objects); ++i)
+     {
+        obj = eina_array_data_get(objects, i);
+        n = atk_object_get_n_accessible_children(obj);
+
+        parent = eina_inarray_nth(nodes, i);
+        parent->first_child = eina_inarray_count(nodes);
+
+        for (j = 0; j < n; ++j)
+          {
+             child = atk_object_ref_accessible_child(obj, j);
+             if (!child) continue;
+
+             if (eina_hash_find(visited, &child))
+               {
+                  g_object_unref(child);
+                  continue;
+               }
+
+             memset(&node, 0, sizeof(node));
+             node.parent = i;
+             _eail_tree_node_fill(&node, child, names);
+             eina_inarray_push(nodes, &node);
+             eina_array_push(objects, child);
+             eina_hash_add(visited, &child, child);
+
+             parent = eina_inarray_nth(nodes, i);
+             parent->n_children++;
+          }
+     }
+
+   while ((obj = eina_array_pop(objects)))
+     g_object_unref(obj);
+   eina_array_free(objects);
+   eina_hash_free(visited);
+
+   snapshot->count = eina_inarray_count(nodes);
+   snapshot->nodes = malloc(snapshot->count * sizeof(Eail_Tree_Node));
+   if (snapshot->nodes)
+     memcpy(snapshot->nodes, eina_inarray_nth(nodes, 0),
+            snapshot->count * sizeof(Eail_Tree_Node));
+   else
+     snapshot->count = 0;
+   eina_inarray_free(nodes);
+
+   snapshot->names_size = eina_strbuf_length_get(names);
+   snapshot->names = eina_strbuf_string_steal(names);
+   eina_strbuf_free(names);
+
+   return snapshot;
+}
+
+/**
+ * @param snapshot an Eail_Tree_Snapshot
+ */
+EAPI void
+eail_tree_snapshot_free(Eail_Tree_Snapshot *snapshot)
+{
+   if (!snapshot) return;
+
+   free(snapshot->nodes);
+   free(snapshot->names);
+   free(snapshot);
+}
+
+/**
+ * @param snapshot an Eail_Tree_Snapshot
+ * @param index index of node
+ *
+ * @return name of node, empty string for nodes without name or NULL if
+ * index is out of range. Returned string is owned by snapshot
+ */
+EAPI const char *
+eail_tree_snapshot_name_get(const Eail_Tree_Snapshot *snapshot,
+                            unsigned int index)
+{
+   if (!snapshot || index >= snapshot->count) return NULL;
+   if (snapshot->nodes[index].name >= snapshot->names_size) return NULL;
+
+   return snapshot->names + snapshot->nodes[index].name;
+}
+
+/**
+ * @brief Stores 32 bit value as little endian
+ *
+ * @param buf buffer to write to
+ * @param value value to store
+ * @return position in buffer after stored value
+ */
+static unsigned char *
+_eail_tree_put_u32(unsigned char *buf, unsigned int value)
+{
+   buf[0] = value & 0xff;
+   buf[1] = (value >> 8) & 0xff;
+   buf[2] = (value >> 16) & 0xff;
+   buf[3] = (value >> 24) & 0xff;
+
+   return buf + 4;
+}
+
+/**
+ * Buffer holds header (magic "EAIL", format version, node count, names
+ * size), nodes with every field stored as little endian 32 bit value
+ * (states as two values, lower half first) and names buffer. Layout does
+ * not depend on platform, so snapshots can be stored and compared later.
+ *
+ * @param snapshot an Eail_Tree_Snapshot
+ * @param size address of unsigned int to put buffer size in
+ *
+ * @return newly allocated buffer or NULL on failure. Should be freed with
+ * free
+ */
+EAPI unsigned char *
+eail_tree_snapshot_serialize(const Eail_Tree_Snapshot *snapshot,
+                             unsigned int *size)
+{
+   unsigned char *buf, *pos;
+   const Eail_Tree_Node *node;
+   unsigned int i, total;
+
+   if (!snapshot || !size) return NULL;
+
+   total = EAIL_TREE_SNAPSHOT_HEADER_SIZE +
+           snapshot->count * EAIL_TREE_SNAPSHOT_NODE_SIZE +
+           snapshot->names_size;
+   buf = malloc(total);
+   if (!buf) return NULL;
+
+   memcpy(buf, EAIL_TREE_SNAPSHOT_MAGIC, 4);
+   pos = _eail_tree_put_u32(buf + 4, EAIL_TREE_SNAPSHOT_VERSION);
+   pos = _eail_tree_put_u32(pos, snapshot->count);
+   pos = _eail_tree_put_u32(pos, snapshot->names_size);
+
+   for (i = 0; i < snapshot->count; ++i)
+     {
+        node = &snapshot->nodes[i];
+        pos = _eail_tree_put_u32(pos, node->role);
+        pos = _eail_tree_put_u32(pos, node->name);
+        pos = _eail_tree_put_u32(pos, node->states & 0xffffffff);
+        pos = _eail_tree_put_u32(pos, node->states >> 32);
+        pos = _eail_tree_put_u32(pos, node->x);
+        pos = _eail_tree_put_u32(pos, node->y);
+        pos = _eail_tree_put_u32(pos, node->width);
+        pos = _eail_tree_put_u32(pos, node->height);
+        pos = _eail_tree_put_u32(pos, node->parent);
+        pos = _eail_tree_put_u32(pos, node->first_child);
+        pos = _eail_tree_put_u32(pos, node->n_children);
+     }
+
+   if (snapshot->names_size)
+     memcpy(pos, snapshot->names, snapshot->names_size);
+
+   *size = total;
+
+   return buf;
+}
+
 /**
  * @brief Callback to be called when an object receives focus
  *
@@ -160,6 +427,8 @@ elm_modapi_init(void *m)
    g_type_init();
 #endif
 
+   eail_factory_init();
+
    atk_util_install();
 
    atk_misc_instance = g_object_new(ATK_TYPE_MISC, NULL);
@@ -179,6 +448,12 @@ elm_modapi_init(void *m)
 int
 elm_modapi_shutdown(void *m)
 {
+   eail_focus_shutdown();
+   eail_events_shutdown();
+   eail_factory_shutdown();
+   eail_item_parent_pool_shutdown();
+   eail_item_del_watch_shutdown();
+
    if ((_eail_log_dom > -1) && (_eail_log_dom != EINA_LOG_DOMAIN_GLOBAL))
      {
         eina_log_domain_unregister(_eail_log_dom);
@@ -25,14 +25,79 @@
 #define EAIL_H
 
 #include "Elementary.h"
+#include <atk/atk.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief Value of Eail_Tree_Node parent for root node
+ */
+#define EAIL_TREE_NO_PARENT (-1)
+
+typedef struct _Eail_Tree_Node Eail_Tree_Node;
+typedef struct _Eail_Tree_Snapshot Eail_Tree_Snapshot;
+
+/**
+ * @brief Record describing single accessible object in tree snapshot
+ */
+struct _Eail_Tree_Node
+{
+   AtkRole role;/**< @brief role of accessible */
+   unsigned int name;/**< @brief offset of name in snapshot names buffer */
+   unsigned long long states;/**< @brief bit mask of AtkStateType, bit n set
+                                if state n is in accessible state set */
+   int x;/**< @brief x coordinate relative to window */
+   int y;/**< @brief y coordinate relative to window */
+   int width;/**< @brief width of accessible */
+   int height;/**< @brief height of accessible */
+   int parent;/**< @brief index of parent node, EAIL_TREE_NO_PARENT for root */
+   unsigned int first_child;/**< @brief index of first child node */
+   unsigned int n_children;/**< @brief number of children nodes */
+};
+
+/**
+ * @brief Flat snapshot of accessibility tree of window
+ *
+ * Nodes are stored in breadth-first order, so children of every node occupy
+ * continuous range of nodes array. Node 0 is the window itself.
+ */
+struct _Eail_Tree_Snapshot
+{
+   Eail_Tree_Node *nodes;/**< @brief array of nodes */
+   unsigned int count;/**< @brief number of nodes */
+   char *names;/**< @brief NUL separated names of nodes, offset 0 holds empty
+                  string used for nodes without name */
+   unsigned int names_size;/**< @brief size of names buffer in bytes */
+};
+
 EAPI int elm_modapi_init(void *m);
 EAPI int elm_modapi_shutdown(void *m);
 
+/**
+ * @brief Takes snapshot of accessibility tree of given window
+ */
+EAPI Eail_Tree_Snapshot *eail_tree_snapshot(Evas_Object *win);
+
+/**
+ * @brief Frees tree snapshot
+ */
+EAPI void eail_tree_snapshot_free(Eail_Tree_Snapshot *snapshot);
+
+/**
+ * @brief Gets name of snapshot node
+ */
+EAPI const char *eail_tree_snapshot_name_get(const Eail_Tree_Snapshot *snapshot,
+                                             unsigned int index);
+
+/**
+ * @brief Serializes tree snapshot to binary buffer
+ */
+EAPI unsigned char *eail_tree_snapshot_serialize
+                                    (const Eail_Tree_Snapshot *snapshot,
+                                     unsigned int *size);
+
 #ifdef __cplusplus
 }
 #endif
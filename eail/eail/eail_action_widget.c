@@ -22,6 +22,8 @@
  * @brief Implementation of widget that can hold atk actions
  */
 
+#include <string.h>
+
 #include <Elementary.h>
 
 #include "eail_action_widget.h"
@@ -38,31 +40,6 @@ G_DEFINE_TYPE_WITH_CODE(EailActionWidget,
                         G_IMPLEMENT_INTERFACE(ATK_TYPE_ACTION,
                                               atk_action_interface_init))
 
-typedef struct _EailActionObj EailActionObj;
-
-/** @struct ActionObject stored in actions list
- */
-struct _EailActionObj
-{
-   const gchar * name;/*!< \brief action name */
-   const gchar * keybinding;/*!< \brief action keybinding */
-   gchar * description;/*!< \brief action description */
-   Eail_Do_Action_Cb action;/*!< \brief action callback */
-};
-
-/**
- * @brief Initializer for AtkObjectClass
- */
-static void
-eail_action_widget_initialize(AtkObject *obj, gpointer data)
-{
-   ATK_OBJECT_CLASS(eail_action_widget_parent_class)->initialize(obj, data);
-
-   EailActionWidget *widget = EAIL_ACTION_WIDGET(obj);
-
-   widget->action_objs = NULL;
-}
-
 /**
  * @brief Initializer for GObject class
  */
@@ -71,37 +48,22 @@ eail_action_widget_init(EailActionWidget *action_widget)
 {
 }
 
-/**
- * @brief Deallocates memory for EailActionObj
- */
-static void
-eail_action_obj_free(EailActionObj *action_obj)
-{
-   g_return_if_fail(action_obj);
-
-   if (action_obj->description)
-     g_free(action_obj->description);
-
-   g_free(action_obj);
-}
-
 /**
  * @brief Finalize function for GObject
  */
 static void
 eail_action_widget_finalize(GObject *object)
 {
-   EailActionWidget *widget = NULL;
-   const Eina_List *l = NULL;
-   EailActionObj *action_obj = NULL;
-
-   widget = EAIL_ACTION_WIDGET(object);
-   g_return_if_fail(widget);
+   EailActionWidget *widget = EAIL_ACTION_WIDGET(object);
+   guint i, n = EAIL_ACTION_WIDGET_GET_CLASS(widget)->n_actions;
 
-   EINA_LIST_FOREACH(widget->action_objs, l, action_obj)
-     eail_action_obj_free(action_obj);
+   if (widget->descriptions)
+     {
+        for (i = 0; i < n; ++i)
+          g_free(widget->descriptions[i]);
 
-   eina_list_free(widget->action_objs);
+        g_free(widget->descriptions);
+     }
 
    G_OBJECT_CLASS(eail_action_widget_parent_class)->finalize(object);
 }
@@ -112,35 +74,46 @@ eail_action_widget_finalize(GObject *object)
 static void
 eail_action_widget_class_init(EailActionWidgetClass *klass)
 {
-   AtkObjectClass *class = ATK_OBJECT_CLASS(klass);
    GObjectClass *gobject_class = G_OBJECT_CLASS(klass);
-   class->initialize = eail_action_widget_initialize;
    gobject_class->finalize = eail_action_widget_finalize;
+
+   klass->actions = NULL;
+   klass->n_actions = 0;
 }
 
 /**
- * @param action_widget ActionWidget instance that holds actions
- * @param action_name action name
- * @param keybinding keybinding
- * @param action_cb callback for action, launched when action is triggered
+ * Actions are meant to be appended once, in class_init of class. Given
+ * table is used directly if class has no actions inherited, so it has to
+ * outlive the class, e.g. be static.
+ *
+ * @param klass EailActionWidgetClass that holds actions
+ * @param actions table of action definitions
+ * @param n_actions number of actions in table
  */
 void
-eail_action_widget_action_append(EailActionWidget *action_widget,
-                                 const gchar *action_name,
-                                 const gchar *keybinding,
-                                 Eail_Do_Action_Cb action_cb)
+eail_action_widget_class_actions_append(EailActionWidgetClass *klass,
+                                        const EailActionDef *actions,
+                                        guint n_actions)
 {
-   g_return_if_fail(action_widget);
+   EailActionDef *merged;
 
-   EailActionObj *action_def_obj = g_new0(EailActionObj, 1);
+   g_return_if_fail(EAIL_IS_ACTION_WIDGET_CLASS(klass));
 
-   action_def_obj->name = action_name;
-   action_def_obj->keybinding = keybinding;
-   action_def_obj->action = action_cb;
+   if (!klass->n_actions)
+     {
+        klass->actions = actions;
+        klass->n_actions = n_actions;
+        return;
+     }
 
-   action_widget->action_objs = eina_list_append
-                              (action_widget->action_objs, action_def_obj);
+   /* parent class actions go first, merged table lives as long as class */
+   merged = g_new(EailActionDef, klass->n_actions + n_actions);
+   memcpy(merged, klass->actions, klass->n_actions * sizeof(EailActionDef));
+   memcpy(merged + klass->n_actions, actions,
+          n_actions * sizeof(EailActionDef));
 
+   klass->actions = merged;
+   klass->n_actions += n_actions;
 }
 
 /**
@@ -152,33 +125,33 @@ eail_action_widget_action_append(EailActionWidget *action_widget,
 static int
 eail_action_widget_n_actions_get(AtkAction *action)
 {
-   EailActionWidget *widget =  EAIL_ACTION_WIDGET(action);
-   g_return_val_if_fail(widget, 0);
+   g_return_val_if_fail(EAIL_IS_ACTION_WIDGET(action), 0);
 
-   return eina_list_count(widget->action_objs);
+   return EAIL_ACTION_WIDGET_GET_CLASS(action)->n_actions;
 }
 
 /**
- * @brief Returns EailActionObj of action with given index
+ * @brief Returns EailActionDef of action with given index
  *
  * @param action object that implements AtkAction interface
  * @param i index (number) of action
  */
-static EailActionObj *
-eail_get_action_obj_i(AtkAction *action,
+static const EailActionDef *
+eail_get_action_def_i(AtkAction *action,
                       int i)
 {
-   EailActionWidget *widget =  EAIL_ACTION_WIDGET(action);
-   g_return_val_if_fail(widget, NULL);
-   g_return_val_if_fail(i < eina_list_count(widget->action_objs), NULL);
+   EailActionWidgetClass *klass;
+
+   g_return_val_if_fail(EAIL_IS_ACTION_WIDGET(action), NULL);
 
-   EailActionObj *actionObj = eina_list_nth(widget->action_objs, i);
+   klass = EAIL_ACTION_WIDGET_GET_CLASS(action);
+   g_return_val_if_fail(i >= 0 && (guint)i < klass->n_actions, NULL);
 
-   return actionObj;
+   return &klass->actions[i];
 }
 
 /**
- * @brief Returns EailActionObj of action with given index
+ * @brief Returns name of action with given index
  *
  * @param action object that implements AtkAction interface
  * @param i index (number) of action
@@ -187,10 +160,10 @@ static const gchar*
 eail_action_widget_action_name_get(AtkAction *action,
                                    int i)
 {
-   EailActionObj *actionObj = eail_get_action_obj_i(action, i);
-   g_return_val_if_fail(actionObj, NULL);
+   const EailActionDef *action_def = eail_get_action_def_i(action, i);
+   g_return_val_if_fail(action_def, NULL);
 
-   return actionObj->name;
+   return action_def->name;
 }
 
 /**
@@ -205,10 +178,10 @@ static gboolean
 eail_action_widget_do_action(AtkAction *action,
                              int i)
 {
-   EailActionObj *actionObj = eail_get_action_obj_i(action, i);
-   g_return_val_if_fail(actionObj, FALSE);
+   const EailActionDef *action_def = eail_get_action_def_i(action, i);
+   g_return_val_if_fail(action_def, FALSE);
 
-   return (actionObj->action)(action, NULL);
+   return (action_def->action)(action, NULL);
 }
 
 /**
@@ -224,10 +197,14 @@ static const gchar*
 eail_action_widget_description_get(AtkAction *action,
                                    int i)
 {
-   EailActionObj *actionObj = eail_get_action_obj_i(action, i);
-   g_return_val_if_fail(actionObj, NULL);
+   EailActionWidget *widget = EAIL_ACTION_WIDGET(action);
+   const EailActionDef *action_def = eail_get_action_def_i(action, i);
+   g_return_val_if_fail(action_def, NULL);
+
+   if (!widget->descriptions)
+     return NULL;
 
-   return actionObj->description;
+   return widget->descriptions[i];
 }
 
 /**
@@ -245,13 +222,17 @@ eail_action_widget_description_set(AtkAction *action,
                                    int i,
                                    const char *description)
 {
-   EailActionObj *actionObj = eail_get_action_obj_i(action, i);
-   g_return_val_if_fail(actionObj, FALSE);
+   EailActionWidget *widget = EAIL_ACTION_WIDGET(action);
+   const EailActionDef *action_def = eail_get_action_def_i(action, i);
+   g_return_val_if_fail(action_def, FALSE);
 
-   if (actionObj->description)
-     g_free(actionObj->description);
+   /* descriptions are rarely set, so they are allocated on demand */
+   if (!widget->descriptions)
+     widget->descriptions =
+        g_new0(gchar *, EAIL_ACTION_WIDGET_GET_CLASS(widget)->n_actions);
 
-   actionObj->description = g_strdup(description);
+   g_free(widget->descriptions[i]);
+   widget->descriptions[i] = g_strdup(description);
    return TRUE;
 }
 
@@ -29,7 +29,7 @@
 #define EAIL_TYPE_ACTION_WIDGET             (eail_action_widget_get_type())
 #define EAIL_ACTION_WIDGET(obj)             (G_TYPE_CHECK_INSTANCE_CAST((obj), \
                                              EAIL_TYPE_ACTION_WIDGET, EailActionWidget))
-#define EAIL_ACTION_WIDGET_CLASS(klass)     (G_TYPE_ACTION_WIDGET_CLASS_CAST((klass), \
+#define EAIL_ACTION_WIDGET_CLASS(klass)     (G_TYPE_CHECK_CLASS_CAST((klass), \
                                              EAIL_TYPE_ACTION_WIDGET, EailActionWidgetClass))
 #define EAIL_IS_ACTION_WIDGET(obj)          (G_TYPE_CHECK_INSTANCE_TYPE((obj), \
                                              EAIL_TYPE_ACTION_WIDGET))
@@ -49,23 +49,38 @@ typedef struct _EailActionWidgetClass EailActionWidgetClass;
  */
 typedef gboolean (* Eail_Do_Action_Cb) (AtkAction *obj, void *data);
 
-/*! \brief Appends given action to action list used by EailActionWidget
+typedef struct _EailActionDef EailActionDef;
+
+/*! \brief Definition of action shared by all instances of class
+ */
+struct _EailActionDef
+{
+   const gchar *name;/*!< action name */
+   const gchar *keybinding;/*!< action keybinding */
+   Eail_Do_Action_Cb action;/*!< action callback */
+};
+
+/*! \brief Appends given actions to actions of EailActionWidget class
  */
-void eail_action_widget_action_append(EailActionWidget *action_widget,
-                                      const gchar *action_name,
-                                      const gchar *keybinding,
-                                      Eail_Do_Action_Cb action_cb);
+void eail_action_widget_class_actions_append(EailActionWidgetClass *klass,
+                                             const EailActionDef *actions,
+                                             guint n_actions);
 
 struct _EailActionWidget
 {
    EailWidget parent;/*!< widget that is being extended */
 
-   Eina_List *action_objs;/*!< list of action objects (EailActionObj*) */
+   gchar **descriptions;/*!< descriptions of class actions, NULL until
+                          first description is set */
 };
 
 struct _EailActionWidgetClass
 {
    EailWidgetClass parent_class;
+
+   const EailActionDef *actions;/*!< actions of class, parent class actions
+                                  go first */
+   guint n_actions;/*!< number of actions of class */
 };
 
 GType eail_action_widget_get_type(void);
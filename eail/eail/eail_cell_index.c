@@ -0,0 +1,697 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_cell_index.c
+ * @brief Implementation of cell index shared by table-like containers
+ */
+
+#include <stdlib.h>
+
+#include "eail_cell_index.h"
+
+/**
+ * @brief Creates index for given number of children
+ *
+ * All children start as single empty cells at row 0 and column 0.
+ *
+ * @param n_cells number of children
+ *
+ * @returns new index, free it with eail_cell_index_free
+ */
+EailCellIndex *
+eail_cell_index_new(gint n_cells)
+{
+   EailCellIndex *index = g_new0(EailCellIndex, 1);
+
+   index->n_cells = MAX(n_cells, 0);
+   index->cells = g_new0(EailCell, index->n_cells);
+
+   return index;
+}
+
+/**
+ * @brief Sets position and span of child with given index
+ *
+ * For compressed index position and span are given in any units, for
+ * example virtual coordinates of grid.
+ *
+ * @param index an EailCellIndex
+ * @param i index of child
+ * @param row first row of child
+ * @param column first column of child
+ * @param row_span number of rows child spans
+ * @param column_span number of columns child spans
+ */
+void
+eail_cell_index_set_cell(EailCellIndex *index,
+                         gint i,
+                         gint row,
+                         gint column,
+                         gint row_span,
+                         gint column_span)
+{
+   g_return_if_fail(index && i >= 0 && i < index->n_cells);
+
+   index->cells[i].row = row;
+   index->cells[i].column = column;
+   index->cells[i].row_span = MAX(row_span, 1);
+   index->cells[i].column_span = MAX(column_span, 1);
+}
+
+/**
+ * @brief Compares two gints for qsort and bsearch
+ */
+static int
+_compare_ints(const void *a, const void *b)
+{
+   gint x = *(const gint *)a, y = *(const gint *)b;
+
+   return (x > y) - (x < y);
+}
+
+/**
+ * @brief Sorts given values and removes duplicates
+ *
+ * @param values array of values
+ * @param n number of values
+ *
+ * @returns number of unique values left at start of array
+ */
+static gint
+_sort_unique(gint *values, gint n)
+{
+   gint i, n_unique = 0;
+
+   qsort(values, n, sizeof(gint), _compare_ints);
+   for (i = 0; i < n; i++)
+     {
+        if (!n_unique || values[n_unique - 1] != values[i])
+          values[n_unique++] = values[i];
+     }
+
+   return n_unique;
+}
+
+/**
+ * @brief Gets number of sorted values lower than given one
+ */
+static gint
+_count_lower(const gint *values, gint n, gint value)
+{
+   gint low = 0, high = n;
+
+   while (low < high)
+     {
+        gint middle = (low + high) / 2;
+
+        if (values[middle] < value)
+          low = middle + 1;
+        else
+          high = middle;
+     }
+
+   return low;
+}
+
+/**
+ * @brief Turns coordinates of cells into rows and columns
+ *
+ * Every distinct coordinate cells start at begins a row or a column, so
+ * gaps between children do not produce empty rows nor columns. Span of cell
+ * is the number of rows or columns starting inside it.
+ *
+ * @param index an EailCellIndex
+ */
+static void
+_compress(EailCellIndex *index)
+{
+   gint *rows = g_new(gint, index->n_cells);
+   gint *columns = g_new(gint, index->n_cells);
+   gint i, n_rows, n_columns;
+
+   for (i = 0; i < index->n_cells; i++)
+     {
+        rows[i] = index->cells[i].row;
+        columns[i] = index->cells[i].column;
+     }
+
+   n_rows = _sort_unique(rows, index->n_cells);
+   n_columns = _sort_unique(columns, index->n_cells);
+
+   for (i = 0; i < index->n_cells; i++)
+     {
+        EailCell *cell = &index->cells[i];
+        gint row = _count_lower(rows, n_rows, cell->row);
+        gint column = _count_lower(columns, n_columns, cell->column);
+
+        cell->row_span = MAX(_count_lower(rows, n_rows,
+                                          cell->row + cell->row_span) - row, 1);
+        cell->column_span =
+           MAX(_count_lower(columns, n_columns,
+                            cell->column + cell->column_span) - column, 1);
+        cell->row = row;
+        cell->column = column;
+     }
+
+   g_free(rows);
+   g_free(columns);
+}
+
+/**
+ * @brief Maximal number of places in dense lookup of index with given number
+ * of cells
+ *
+ * Tables and grids are filled densely in practice, so lookup grows with the
+ * number of children. Sparse ones are served by scanning cells instead.
+ */
+#define EAIL_CELL_INDEX_MAX_PLACES(n_cells) (4 * (gint64)(n_cells) + 64)
+
+/**
+ * @brief Builds row and column lookup after all cells are set
+ *
+ * Cells placed at negative rows or columns are left out of lookup. When
+ * cells overlap, place belongs to the child that comes first. Dense lookup
+ * is built only when table is not much bigger than number of cells, so
+ * children packed far apart or with huge spans do not make it explode.
+ *
+ * @param index an EailCellIndex
+ * @param compress TRUE if cells are given in coordinates that have to be
+ * turned into rows and columns, FALSE if they are rows and columns already
+ */
+void
+eail_cell_index_build(EailCellIndex *index, gboolean compress)
+{
+   gint i, row, column;
+
+   g_return_if_fail(index);
+
+   if (compress) _compress(index);
+
+   index->n_rows = 0;
+   index->n_columns = 0;
+   for (i = 0; i < index->n_cells; i++)
+     {
+        const EailCell *cell = &index->cells[i];
+
+        if (cell->row < 0 || cell->column < 0) continue;
+
+        index->n_rows = MAX(index->n_rows, cell->row + cell->row_span);
+        index->n_columns =
+           MAX(index->n_columns, cell->column + cell->column_span);
+     }
+
+   g_free(index->grid);
+   index->grid = NULL;
+
+   if ((gint64)index->n_rows * index->n_columns >
+       EAIL_CELL_INDEX_MAX_PLACES(index->n_cells))
+     return;
+
+   index->grid = g_new(gint, index->n_rows * index->n_columns);
+   for (i = 0; i < index->n_rows * index->n_columns; i++)
+     index->grid[i] = -1;
+
+   for (i = 0; i < index->n_cells; i++)
+     {
+        const EailCell *cell = &index->cells[i];
+
+        if (cell->row < 0 || cell->column < 0) continue;
+
+        for (row = cell->row; row < cell->row + cell->row_span; row++)
+          for (column = cell->column;
+               column < cell->column + cell->column_span;
+               column++)
+            {
+               gint *place = &index->grid[row * index->n_columns + column];
+
+               if (*place == -1) *place = i;
+            }
+     }
+}
+
+/**
+ * @brief Gets index of child placed at given row and column
+ *
+ * Dense lookup takes constant time, sparse index is scanned in child order.
+ *
+ * @param index an EailCellIndex
+ * @param row row number
+ * @param column column number
+ *
+ * @returns index of child or -1 if place is empty or out of table
+ */
+gint
+eail_cell_index_at(const EailCellIndex *index, gint row, gint column)
+{
+   gint i;
+
+   g_return_val_if_fail(index, -1);
+
+   if (row < 0 || column < 0 ||
+       row >= index->n_rows || column >= index->n_columns)
+     return -1;
+
+   if (index->grid)
+     return index->grid[row * index->n_columns + column];
+
+   for (i = 0; i < index->n_cells; i++)
+     {
+        const EailCell *cell = &index->cells[i];
+
+        if (cell->row >= 0 && cell->column >= 0 &&
+            row >= cell->row && row - cell->row < cell->row_span &&
+            column >= cell->column &&
+            column - cell->column < cell->column_span)
+          return i;
+     }
+
+   return -1;
+}
+
+/**
+ * @brief Gets cell of child with given index
+ *
+ * @param index an EailCellIndex
+ * @param i index of child
+ *
+ * @returns cell of child or NULL if there is no such child
+ */
+const EailCell *
+eail_cell_index_get_cell(const EailCellIndex *index, gint i)
+{
+   g_return_val_if_fail(index, NULL);
+
+   if (i < 0 || i >= index->n_cells) return NULL;
+
+   return &index->cells[i];
+}
+
+/**
+ * @brief Callback for change of container size hints
+ *
+ * Packing child at other place or with other span lays container out
+ * again, which changes its size hints. Index is only marked as outdated
+ * here, so children are not read again until cells are requested.
+ *
+ * @param data an EailCellIndex
+ * @param e an Evas
+ * @param obj container
+ * @param event_info additional event info (not used here)
+ */
+static void
+_eail_cell_index_on_container_hints(void *data, Evas *e, Evas_Object *obj,
+                                    void *event_info)
+{
+   EailCellIndex *index = data;
+
+   index->valid = FALSE;
+}
+
+/**
+ * @brief Callback for deletion of container
+ *
+ * @param data an EailCellIndex
+ * @param e an Evas
+ * @param obj deleted container
+ * @param event_info additional event info (not used here)
+ */
+static void
+_eail_cell_index_on_container_del(void *data, Evas *e, Evas_Object *obj,
+                                  void *event_info)
+{
+   EailCellIndex *index = data;
+
+   index->container = NULL;
+   index->valid = FALSE;
+}
+
+/**
+ * @brief Callback for deletion of tracked child
+ *
+ * @param data an EailCellIndex
+ * @param e an Evas
+ * @param obj deleted child
+ * @param event_info additional event info (not used here)
+ */
+static void
+_eail_cell_index_on_child_del(void *data, Evas *e, Evas_Object *obj,
+                              void *event_info)
+{
+   EailCellIndex *index = data;
+
+   eina_hash_del_by_key(index->tracked, &obj);
+   index->valid = FALSE;
+}
+
+/**
+ * @brief Stops tracking child, called for each tracked child
+ */
+static Eina_Bool
+_eail_cell_index_untrack_child(const Eina_Hash *hash, const void *key,
+                               void *data, void *fdata)
+{
+   Evas_Object *child = *(Evas_Object **)key;
+
+   evas_object_event_callback_del_full(child, EVAS_CALLBACK_DEL,
+                                       _eail_cell_index_on_child_del, fdata);
+
+   return EINA_TRUE;
+}
+
+/**
+ * Cells are read with pack_get. Children and container are tracked until
+ * index is freed, and index stops being valid as soon as any child is
+ * deleted or container is laid out again, e.g. because child has been
+ * packed at other place.
+ *
+ * @param container table-like container children are packed in
+ * @param children array of Evas_Object* children in child order
+ * @param pack_get getter of position and span of child
+ * @param compress TRUE if pack_get gives coordinates that have to be turned
+ * into rows and columns, FALSE if it gives rows and columns
+ *
+ * @returns new index, free it with eail_cell_index_free
+ */
+EailCellIndex *
+eail_cell_index_new_for_children(Evas_Object *container,
+                                 Eina_Array *children,
+                                 EailCellPackGetFunc pack_get,
+                                 gboolean compress)
+{
+   EailCellIndex *index;
+   Eina_Array_Iterator iterator;
+   Evas_Object *child;
+   unsigned int i;
+
+   g_return_val_if_fail(container && children && pack_get, NULL);
+
+   index = eail_cell_index_new(eina_array_count(children));
+   index->tracked = eina_hash_pointer_new(NULL);
+   index->container = container;
+   index->valid = TRUE;
+
+   EINA_ARRAY_ITER_NEXT(children, i, child, iterator)
+     {
+        EailCell cell;
+
+        pack_get(child, &cell.row, &cell.column, &cell.row_span,
+                 &cell.column_span);
+        eail_cell_index_set_cell(index, i, cell.row, cell.column,
+                                 cell.row_span, cell.column_span);
+
+        eina_hash_add(index->tracked, &child, child);
+        evas_object_event_callback_add(child, EVAS_CALLBACK_DEL,
+                                       _eail_cell_index_on_child_del, index);
+     }
+   eail_cell_index_build(index, compress);
+
+   evas_object_event_callback_add(container, EVAS_CALLBACK_CHANGED_SIZE_HINTS,
+                                  _eail_cell_index_on_container_hints, index);
+   evas_object_event_callback_add(container, EVAS_CALLBACK_DEL,
+                                  _eail_cell_index_on_container_del, index);
+
+   return index;
+}
+
+/**
+ * @param index an EailCellIndex
+ *
+ * @returns FALSE if any tracked child has been deleted or container has been
+ * laid out again since index was created, TRUE otherwise
+ */
+gboolean
+eail_cell_index_is_valid(const EailCellIndex *index)
+{
+   g_return_val_if_fail(index, FALSE);
+
+   return !index->tracked || index->valid;
+}
+
+/**
+ * @brief Frees index
+ *
+ * @param index an EailCellIndex
+ */
+void
+eail_cell_index_free(EailCellIndex *index)
+{
+   if (!index) return;
+
+   if (index->tracked)
+     {
+        eina_hash_foreach(index->tracked, _eail_cell_index_untrack_child,
+                          index);
+        eina_hash_free(index->tracked);
+     }
+
+   if (index->container)
+     {
+        evas_object_event_callback_del_full
+           (index->container, EVAS_CALLBACK_CHANGED_SIZE_HINTS,
+            _eail_cell_index_on_container_hints, index);
+        evas_object_event_callback_del_full
+           (index->container, EVAS_CALLBACK_DEL,
+            _eail_cell_index_on_container_del, index);
+     }
+
+   g_free(index->cells);
+   g_free(index->grid);
+   g_free(index);
+}
+
+/*
+ * Implementation of the *AtkTable* interface
+ */
+
+/**
+ * @brief Gets quark under which cell index getter of type is stored
+ */
+static GQuark
+_eail_cell_index_getter_quark(void)
+{
+   static GQuark quark = 0;
+
+   if (!quark)
+     quark = g_quark_from_static_string("eail-cell-index-getter");
+
+   return quark;
+}
+
+/**
+ * @brief Gets cell index of table with getter registered for its type
+ *
+ * Getter is looked up in ancestors too, as subclasses share interface
+ * implementation of their parent.
+ *
+ * @param table an AtkTable
+ *
+ * @returns cell index of table children or NULL if there is none
+ */
+static EailCellIndex *
+_eail_cell_index_table_cells_get(AtkTable *table)
+{
+   EailCellIndexGetFunc get_cells = NULL;
+   GType type;
+
+   for (type = G_OBJECT_TYPE(table); type && !get_cells;
+        type = g_type_parent(type))
+     get_cells = (EailCellIndexGetFunc)
+        g_type_get_qdata(type, _eail_cell_index_getter_quark());
+
+   return get_cells ? get_cells(table) : NULL;
+}
+
+/**
+ * @brief Implementation of get_n_rows from AtkTable
+ *
+ * @param table an AtkTable
+ *
+ * @returns number of rows
+ */
+static gint
+_eail_cell_index_table_n_rows_get(AtkTable *table)
+{
+   EailCellIndex *cells = _eail_cell_index_table_cells_get(table);
+
+   return cells ? cells->n_rows : 0;
+}
+
+/**
+ * @brief Implementation of get_n_columns from AtkTable
+ *
+ * @param table an AtkTable
+ *
+ * @returns number of columns
+ */
+static gint
+_eail_cell_index_table_n_columns_get(AtkTable *table)
+{
+   EailCellIndex *cells = _eail_cell_index_table_cells_get(table);
+
+   return cells ? cells->n_columns : 0;
+}
+
+/**
+ * @brief Implementation of get_index_at from AtkTable
+ *
+ * @param table an AtkTable
+ * @param row number of row in table
+ * @param column number of column in table
+ *
+ * @returns index of child at specified position, -1 if there is none
+ */
+static gint
+_eail_cell_index_table_index_at_get(AtkTable *table, gint row, gint column)
+{
+   EailCellIndex *cells = _eail_cell_index_table_cells_get(table);
+
+   return cells ? eail_cell_index_at(cells, row, column) : -1;
+}
+
+/**
+ * @brief Implementation of ref_at from AtkTable
+ *
+ * @param table an AtkTable
+ * @param row number of row in table
+ * @param column number of column in table
+ *
+ * @returns referred child object
+ */
+static AtkObject *
+_eail_cell_index_table_ref_at(AtkTable *table, gint row, gint column)
+{
+   gint index = _eail_cell_index_table_index_at_get(table, row, column);
+
+   if (index == -1) return NULL;
+
+   return atk_object_ref_accessible_child(ATK_OBJECT(table), index);
+}
+
+/**
+ * @brief Gets cell of child with given index in table
+ *
+ * @param table an AtkTable
+ * @param index index of child
+ *
+ * @returns cell of child or NULL if there is no such child
+ */
+static const EailCell *
+_eail_cell_index_table_cell_get(AtkTable *table, gint index)
+{
+   EailCellIndex *cells = _eail_cell_index_table_cells_get(table);
+
+   return cells ? eail_cell_index_get_cell(cells, index) : NULL;
+}
+
+/**
+ * @brief Implementation of get_row_at_index from AtkTable
+ *
+ * @param table an AtkTable
+ * @param index index of child
+ *
+ * @returns first row of child, -1 if there is no such child
+ */
+static gint
+_eail_cell_index_table_row_at_index_get(AtkTable *table, gint index)
+{
+   const EailCell *cell = _eail_cell_index_table_cell_get(table, index);
+
+   return cell ? cell->row : -1;
+}
+
+/**
+ * @brief Implementation of get_column_at_index from AtkTable
+ *
+ * @param table an AtkTable
+ * @param index index of child
+ *
+ * @returns first column of child, -1 if there is no such child
+ */
+static gint
+_eail_cell_index_table_column_at_index_get(AtkTable *table, gint index)
+{
+   const EailCell *cell = _eail_cell_index_table_cell_get(table, index);
+
+   return cell ? cell->column : -1;
+}
+
+/**
+ * @brief Implementation of get_row_extent_at from AtkTable
+ *
+ * @param table an AtkTable
+ * @param row number of row in table
+ * @param column number of column in table
+ *
+ * @returns number of rows spanned by child at specified position
+ */
+static gint
+_eail_cell_index_table_row_extent_at_get(AtkTable *table, gint row,
+                                         gint column)
+{
+   const EailCell *cell = _eail_cell_index_table_cell_get
+      (table, _eail_cell_index_table_index_at_get(table, row, column));
+
+   return cell ? cell->row_span : 0;
+}
+
+/**
+ * @brief Implementation of get_column_extent_at from AtkTable
+ *
+ * @param table an AtkTable
+ * @param row number of row in table
+ * @param column number of column in table
+ *
+ * @returns number of columns spanned by child at specified position
+ */
+static gint
+_eail_cell_index_table_column_extent_at_get(AtkTable *table, gint row,
+                                            gint column)
+{
+   const EailCell *cell = _eail_cell_index_table_cell_get
+      (table, _eail_cell_index_table_index_at_get(table, row, column));
+
+   return cell ? cell->column_span : 0;
+}
+
+/**
+ * Containers only lay content out, so selection is not supported. Getter is
+ * registered for the type implementing interface.
+ *
+ * @param iface AtkTable interface
+ * @param get_cells getter of up to date cell index of table children
+ */
+void
+eail_cell_index_table_interface_init(AtkTableIface *iface,
+                                     EailCellIndexGetFunc get_cells)
+{
+   g_return_if_fail(iface && get_cells);
+
+   g_type_set_qdata(iface->parent.g_instance_type,
+                    _eail_cell_index_getter_quark(), (gpointer)get_cells);
+
+   iface->ref_at = _eail_cell_index_table_ref_at;
+   iface->get_n_rows = _eail_cell_index_table_n_rows_get;
+   iface->get_n_columns = _eail_cell_index_table_n_columns_get;
+   iface->get_index_at = _eail_cell_index_table_index_at_get;
+   iface->get_row_at_index = _eail_cell_index_table_row_at_index_get;
+   iface->get_column_at_index = _eail_cell_index_table_column_at_index_get;
+   iface->get_row_extent_at = _eail_cell_index_table_row_extent_at_get;
+   iface->get_column_extent_at = _eail_cell_index_table_column_extent_at_get;
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_cell_index.h
+ */
+
+#ifndef EAIL_CELL_INDEX_H
+#define EAIL_CELL_INDEX_H
+
+#include <atk/atk.h>
+#include <Evas.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct _EailCell EailCell;
+typedef struct _EailCellIndex EailCellIndex;
+
+/**
+ * @brief Gets position and span of child packed in container
+ */
+typedef void (*EailCellPackGetFunc)(Evas_Object *child,
+                                    gint *row,
+                                    gint *column,
+                                    gint *row_span,
+                                    gint *column_span);
+
+/**
+ * @brief Gets up to date cell index of AtkTable children
+ */
+typedef EailCellIndex *(*EailCellIndexGetFunc)(AtkTable *table);
+
+/**
+ * @brief Position and span of one child of a table-like container
+ */
+struct _EailCell
+{
+   gint row;/*!< first row of cell */
+   gint column;/*!< first column of cell */
+   gint row_span;/*!< number of rows cell spans */
+   gint column_span;/*!< number of columns cell spans */
+};
+
+/**
+ * @brief Cells of container children with lookup by row and column
+ */
+struct _EailCellIndex
+{
+   EailCell *cells;/*!< cells of children in child order */
+   gint n_cells;/*!< number of cells */
+   gint *grid;/*!< child index at each row and column, -1 for empty place,
+                NULL if index is not built or too sparse for dense lookup */
+   gint n_rows;/*!< number of rows */
+   gint n_columns;/*!< number of columns */
+
+   Eina_Hash *tracked;/*!< tracked child Evas_Object*, NULL if children
+                        are not tracked */
+   Evas_Object *container;/*!< container children are packed in, NULL if
+                            it is not tracked */
+   gboolean valid;/*!< FALSE once any tracked child has been deleted or
+                    container has been laid out again */
+};
+
+/**
+ * @brief Creates index for given number of children
+ */
+EailCellIndex *eail_cell_index_new(gint n_cells);
+
+/**
+ * @brief Sets position and span of child with given index
+ */
+void eail_cell_index_set_cell(EailCellIndex *index,
+                              gint i,
+                              gint row,
+                              gint column,
+                              gint row_span,
+                              gint column_span);
+
+/**
+ * @brief Builds row and column lookup after all cells are set
+ */
+void eail_cell_index_build(EailCellIndex *index, gboolean compress);
+
+/**
+ * @brief Gets index of child placed at given row and column
+ */
+gint eail_cell_index_at(const EailCellIndex *index, gint row, gint column);
+
+/**
+ * @brief Gets cell of child with given index
+ */
+const EailCell *eail_cell_index_get_cell(const EailCellIndex *index, gint i);
+
+/**
+ * @brief Creates index of container children, tracking their packing
+ */
+EailCellIndex *eail_cell_index_new_for_children(Evas_Object *container,
+                                                Eina_Array *children,
+                                                EailCellPackGetFunc pack_get,
+                                                gboolean compress);
+
+/**
+ * @brief Checks if cells of tracked children are still up to date
+ */
+gboolean eail_cell_index_is_valid(const EailCellIndex *index);
+
+/**
+ * @brief Fills AtkTable interface with implementation based on cell index
+ */
+void eail_cell_index_table_interface_init(AtkTableIface *iface,
+                                          EailCellIndexGetFunc get_cells);
+
+/**
+ * @brief Frees index
+ */
+void eail_cell_index_free(EailCellIndex *index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -25,7 +25,7 @@
 #include <Elementary.h>
 
 #include "eail_dayselector.h"
-#include "eail_check.h"
+#include "eail_factory.h"
 
 /**
  * @brief GObject definition for EailDayselector widget
@@ -93,26 +93,6 @@ _eail_dayselector_gen_day_str(int day_num)
    return str_buf;
 }
 
-/**
- * @brief Helper func for creating dayselector child content
- *
- * @param day_check_widget check widget that represents a day in dayselector
- * widget
- *
- * @returns an AtkObject representation of given day in dayselector. Unref
- * it when it is no longer needed.
- */
-static AtkObject *
-_eail_create_dayselector_child(Evas_Object *day_check_widget)
-{
-   AtkObject *child = NULL;
-   child = g_object_new(EAIL_TYPE_CHECK, NULL);
-   atk_object_initialize(child, day_check_widget);
-   g_object_ref(child);
-
-   return child;
-}
-
 /**
  * @brief Implementation AtkObject->ref_child callback
  *
@@ -138,10 +118,12 @@ eail_dayselector_ref_child(AtkObject *obj, gint i)
    day_check = elm_object_part_content_get
                   (ds_widget, eina_strbuf_string_get(part_name));
 
+   eina_strbuf_free(part_name);
+
    /* dayselector consists of objects with type CHECK-widget */
-   child = _eail_create_dayselector_child(day_check);
+   child = eail_factory_get_accessible(day_check);
+   if (child) g_object_ref(child);
 
-   eina_strbuf_free(part_name);
    return child;
 }
 
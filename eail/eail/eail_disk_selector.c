@@ -115,10 +115,8 @@ eail_disk_selector_ref_child(AtkObject *obj, gint i)
 
    if (eina_list_count(items) > i)
      {
-        child = eail_item_new(obj, ATK_ROLE_LIST_ITEM);
-        atk_object_initialize(child, eina_list_nth(items, i));
-
-        g_object_ref(child);
+        child = eail_item_parent_ref_item_accessible
+           (EAIL_ITEM_PARENT(obj), eina_list_nth(items, i), ATK_ROLE_LIST_ITEM);
      }
 
    return child;
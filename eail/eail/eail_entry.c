@@ -56,6 +56,8 @@ eail_entry_initialize(AtkObject *obj, gpointer data)
    Evas_Object *widget = (Evas_Object*)data;
    ATK_OBJECT_CLASS(eail_entry_parent_class)->initialize(obj, data);
 
+   eail_text_track_changes(EAIL_TEXT(obj));
+
    if (elm_entry_password_get(widget))
      obj->role = ATK_ROLE_PASSWORD_TEXT;
    else
@@ -96,6 +98,22 @@ eail_entry_ref_state_set(AtkObject *obj)
    return state_set;
 }
 
+/**
+ * @brief Gets textblock of entry
+ *
+ * @param text an EailText
+ * @return textblock laying out entry text
+ */
+static Evas_Object *
+eail_entry_get_textblock(EailText *text)
+{
+    Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(text));
+
+    if (!widget) return NULL;
+
+    return elm_entry_textblock_get(widget);
+}
+
 /**
  * @brief Initializer for EailEntry GObject implementation
  */
@@ -115,6 +133,7 @@ eail_entry_class_init(EailEntryClass *klass)
 
     class->initialize = eail_entry_initialize;
     class->ref_state_set = eail_entry_ref_state_set;
+    EAIL_TEXT_CLASS(klass)->get_textblock = eail_entry_get_textblock;
 }
 
 /*
@@ -268,7 +287,10 @@ eail_entry_set_text_contents(AtkEditableText *text,
 
    widget = eail_widget_get_widget(EAIL_WIDGET(text));
    if (widget && elm_entry_editable_get(widget))
-     elm_object_text_set(widget, string);
+     {
+        elm_object_text_set(widget, string);
+        eail_text_invalidate_buffer(EAIL_TEXT(text));
+     }
 }
 
 /**
@@ -320,6 +342,7 @@ eail_entry_cut_text(AtkEditableText *text,
    elm_entry_cursor_pos_set(widget, end_pos);
    elm_entry_cursor_selection_end(widget);
    elm_entry_selection_cut(widget);
+   eail_text_invalidate_buffer(EAIL_TEXT(text));
 }
 
 /**
@@ -0,0 +1,609 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_events.c
+ * @brief Implementation of ATK signals emitted for changes of widgets
+ */
+
+#include <Elementary.h>
+
+#include "eail_events.h"
+
+/**
+ * @brief Smart signal emitted by widgets when their content has changed
+ */
+#define EAIL_EVENTS_CHANGED_NAME "changed"
+
+/**
+ * @brief AtkObject property names used in property-change signal
+ */
+#define EAIL_EVENTS_PROPERTY_NAME "accessible-name"
+#define EAIL_EVENTS_PROPERTY_VALUE "accessible-value"
+
+/**
+ * @brief Default minimal interval between value notifications of one object
+ *
+ * Progress bars and sliders may change value on every frame, 10 updates per
+ * second are enough for assistive technologies.
+ */
+#define EAIL_EVENTS_VALUE_INTERVAL 0.1
+
+/**
+ * @brief Default limit of bounds and visible data notifications per flush
+ */
+#define EAIL_EVENTS_MAX_PER_FLUSH 32
+
+/**
+ * @brief Rate limits of one notification type
+ */
+typedef struct _EailEventsLimit EailEventsLimit;
+
+/**
+ * @brief Notifications queued for one AtkObject
+ */
+typedef struct _EailEventsPending EailEventsPending;
+
+/** @brief Rate limits of one notification type */
+struct _EailEventsLimit
+{
+   double min_interval;/**< @brief minimal time between two notifications of
+                          one object, 0 for no limit */
+   unsigned int max_per_flush;/**< @brief maximal number of notifications in
+                                 one flush, 0 for no limit */
+};
+
+/** @brief Notifications queued for one AtkObject */
+struct _EailEventsPending
+{
+   AtkObject *accessible;/**< @brief notified object, weak reference */
+   unsigned int types;/**< @brief bit mask of queued EailEventsType */
+   Eina_Bool queued;/**< @brief whether entry is on the flush list */
+   AtkRectangle bounds;/**< @brief last extents for bounds-changed */
+   double last_emit[EAIL_EVENTS_LAST];/**< @brief time of last emission */
+};
+
+/**
+ * @brief Rate limits indexed by EailEventsType
+ */
+static EailEventsLimit _eail_events_limits[EAIL_EVENTS_LAST] =
+{
+   {0.0, EAIL_EVENTS_MAX_PER_FLUSH},
+   {0.0, EAIL_EVENTS_MAX_PER_FLUSH},
+   {0.0, 0},
+   {EAIL_EVENTS_VALUE_INTERVAL, 0}
+};
+
+/**
+ * @brief Pending entries keyed by AtkObject*
+ */
+static Eina_Hash *_eail_events_pending = NULL;
+
+/**
+ * @brief Entries waiting for flush in order of queuing
+ */
+static Eina_List *_eail_events_queue = NULL;
+
+/**
+ * @brief Idle enterer flushing queue once per main loop iteration
+ */
+static Ecore_Idle_Enterer *_eail_events_flusher = NULL;
+
+/**
+ * @brief Timer waking flusher for rate limited notifications
+ */
+static Ecore_Timer *_eail_events_timer = NULL;
+
+/**
+ * @param parent AtkObject which children have changed
+ * @param added TRUE if child was added, FALSE if it was removed
+ * @param index index of child in parent
+ * @param child added or removed child
+ */
+void
+eail_events_children_changed(AtkObject *parent,
+                             gboolean added,
+                             gint index,
+                             AtkObject *child)
+{
+   g_return_if_fail(ATK_IS_OBJECT(parent));
+
+   if (added)
+     g_signal_emit_by_name(parent, "children-changed::add", index, child);
+   else
+     g_signal_emit_by_name(parent, "children-changed::remove", index, child);
+}
+
+/**
+ * @param accessible an AtkObject implementing AtkComponent
+ * @param x upper left x coordinate
+ * @param y upper left y coordinate
+ * @param width new width
+ * @param height new height
+ */
+void
+eail_events_bounds_changed(AtkObject *accessible,
+                           gint x,
+                           gint y,
+                           gint width,
+                           gint height)
+{
+   AtkRectangle rect;
+
+   g_return_if_fail(ATK_IS_COMPONENT(accessible));
+
+   rect.x = x;
+   rect.y = y;
+   rect.width = width;
+   rect.height = height;
+
+   g_signal_emit_by_name(accessible, "bounds-changed", &rect);
+}
+
+/**
+ * @param accessible an AtkObject
+ */
+void
+eail_events_visible_data_changed(AtkObject *accessible)
+{
+   g_return_if_fail(ATK_IS_OBJECT(accessible));
+
+   g_signal_emit_by_name(accessible, "visible-data-changed");
+}
+
+/**
+ * AtkObject translates notifications of its properties into property-change
+ * signal with proper detail.
+ *
+ * @param accessible an AtkObject
+ * @param property name of AtkObject property, eg. "accessible-name"
+ */
+void
+eail_events_property_changed(AtkObject *accessible, const gchar *property)
+{
+   g_return_if_fail(ATK_IS_OBJECT(accessible));
+
+   g_object_notify(G_OBJECT(accessible), property);
+}
+
+/**
+ * @brief Emits single queued notification
+ *
+ * @param pending an EailEventsPending
+ * @param type type of notification
+ */
+static void
+_eail_events_emit(EailEventsPending *pending, EailEventsType type)
+{
+   AtkObject *accessible = pending->accessible;
+
+   switch (type)
+     {
+      case EAIL_EVENTS_BOUNDS_CHANGED:
+         g_signal_emit_by_name(accessible, "bounds-changed", &pending->bounds);
+         break;
+      case EAIL_EVENTS_VISIBLE_DATA_CHANGED:
+         eail_events_visible_data_changed(accessible);
+         break;
+      case EAIL_EVENTS_NAME_CHANGED:
+         eail_events_property_changed(accessible, EAIL_EVENTS_PROPERTY_NAME);
+         break;
+      case EAIL_EVENTS_VALUE_CHANGED:
+         eail_events_property_changed(accessible, EAIL_EVENTS_PROPERTY_VALUE);
+         break;
+      default:
+         break;
+     }
+}
+
+/**
+ * @brief Frees pending entry
+ *
+ * @param data an EailEventsPending
+ */
+static void
+_eail_events_pending_free(void *data)
+{
+   EailEventsPending *pending = data;
+
+   if (pending->queued)
+     _eail_events_queue = eina_list_remove(_eail_events_queue, pending);
+
+   free(pending);
+}
+
+/**
+ * @brief Removes entry of finalized AtkObject
+ *
+ * @param data not used
+ * @param where_the_object_was finalized AtkObject
+ */
+static void
+_eail_events_weak_notify(gpointer data, GObject *where_the_object_was)
+{
+   eina_hash_del_by_key(_eail_events_pending, &where_the_object_was);
+}
+
+static Eina_Bool _eail_events_flush(void *data);
+
+/**
+ * @brief Wakes up flusher after rate limit interval has passed
+ *
+ * @param data not used
+ * @return ECORE_CALLBACK_CANCEL
+ */
+static Eina_Bool
+_eail_events_on_timer(void *data)
+{
+   _eail_events_timer = NULL;
+
+   if (_eail_events_queue && !_eail_events_flusher)
+     _eail_events_flusher = ecore_idle_enterer_add(_eail_events_flush, NULL);
+
+   return ECORE_CALLBACK_CANCEL;
+}
+
+/**
+ * @brief Emits queued notifications respecting rate limits
+ *
+ * Notifications of an object emitted sooner than min_interval after
+ * previous one and these exceeding max_per_flush stay queued. Queue is
+ * flushed again on next iteration or when the nearest interval passes.
+ *
+ * @param data not used
+ * @return ECORE_CALLBACK_RENEW if notifications over limit are pending,
+ * ECORE_CALLBACK_CANCEL otherwise
+ */
+static Eina_Bool
+_eail_events_flush(void *data)
+{
+   unsigned int emitted[EAIL_EVENTS_LAST] = {0};
+   Eina_List *queue, *left = NULL, *refs = NULL, *l;
+   EailEventsPending *pending;
+   AtkObject *accessible;
+   Eina_Bool over_budget = EINA_FALSE, requeued;
+   double now = ecore_loop_time_get();
+   double wake = 0.0;
+   int type;
+
+   queue = _eail_events_queue;
+   _eail_events_queue = NULL;
+
+   /* handlers must not finalize objects of entries being flushed */
+   EINA_LIST_FOREACH(queue, l, pending)
+     refs = eina_list_append(refs, g_object_ref(pending->accessible));
+
+   EINA_LIST_FREE(queue, pending)
+     {
+        /* entry may be cancelled by handler of previous notification */
+        if (!pending->queued) continue;
+
+        for (type = 0; type < EAIL_EVENTS_LAST; ++type)
+          {
+             EailEventsLimit *limit = &_eail_events_limits[type];
+             double due;
+
+             if (!(pending->types & (1 << type))) continue;
+
+             if (limit->max_per_flush &&
+                 emitted[type] >= limit->max_per_flush)
+               {
+                  over_budget = EINA_TRUE;
+                  continue;
+               }
+
+             due = pending->last_emit[type] + limit->min_interval;
+             if (limit->min_interval > 0.0 && due > now)
+               {
+                  if (wake == 0.0 || due < wake) wake = due;
+                  continue;
+               }
+
+             pending->types &= ~(1 << type);
+             pending->last_emit[type] = now;
+             emitted[type]++;
+             _eail_events_emit(pending, type);
+          }
+
+        if (pending->types)
+          left = eina_list_append(left, pending);
+        else
+          pending->queued = EINA_FALSE;
+     }
+
+   requeued = _eail_events_queue != NULL;
+   _eail_events_queue = eina_list_merge(left, _eail_events_queue);
+
+   EINA_LIST_FREE(refs, accessible)
+     g_object_unref(accessible);
+
+   if (wake > 0.0 && !_eail_events_timer)
+     _eail_events_timer = ecore_timer_add(wake - now, _eail_events_on_timer,
+                                          NULL);
+
+   if (over_budget || requeued)
+     return ECORE_CALLBACK_RENEW;
+
+   _eail_events_flusher = NULL;
+   return ECORE_CALLBACK_CANCEL;
+}
+
+/**
+ * @brief Gets pending entry of AtkObject and puts it on flush list
+ *
+ * @param accessible an AtkObject
+ * @return pending entry
+ */
+static EailEventsPending *
+_eail_events_pending_get(AtkObject *accessible)
+{
+   EailEventsPending *pending;
+
+   if (!_eail_events_pending)
+     _eail_events_pending = eina_hash_pointer_new(_eail_events_pending_free);
+
+   pending = eina_hash_find(_eail_events_pending, &accessible);
+   if (!pending)
+     {
+        pending = calloc(1, sizeof(EailEventsPending));
+        if (!pending) return NULL;
+
+        pending->accessible = accessible;
+        eina_hash_add(_eail_events_pending, &accessible, pending);
+        g_object_weak_ref(G_OBJECT(accessible), _eail_events_weak_notify,
+                          NULL);
+     }
+
+   if (!pending->queued)
+     {
+        pending->queued = EINA_TRUE;
+        _eail_events_queue = eina_list_append(_eail_events_queue, pending);
+     }
+
+   if (!_eail_events_flusher)
+     _eail_events_flusher = ecore_idle_enterer_add(_eail_events_flush, NULL);
+
+   return pending;
+}
+
+/**
+ * Notifications of the same type queued for one object before the flush are
+ * merged into one.
+ *
+ * @param accessible an AtkObject
+ * @param type type of notification
+ */
+void
+eail_events_queue(AtkObject *accessible, EailEventsType type)
+{
+   EailEventsPending *pending;
+
+   g_return_if_fail(ATK_IS_OBJECT(accessible));
+   g_return_if_fail(type < EAIL_EVENTS_LAST);
+
+   pending = _eail_events_pending_get(accessible);
+   if (!pending) return;
+
+   pending->types |= 1 << type;
+}
+
+/**
+ * Only the last extents queued before the flush are reported.
+ *
+ * @param accessible an AtkObject implementing AtkComponent
+ * @param x upper left x coordinate
+ * @param y upper left y coordinate
+ * @param width new width
+ * @param height new height
+ */
+void
+eail_events_queue_bounds(AtkObject *accessible,
+                         gint x,
+                         gint y,
+                         gint width,
+                         gint height)
+{
+   EailEventsPending *pending;
+
+   g_return_if_fail(ATK_IS_COMPONENT(accessible));
+
+   pending = _eail_events_pending_get(accessible);
+   if (!pending) return;
+
+   pending->types |= 1 << EAIL_EVENTS_BOUNDS_CHANGED;
+   pending->bounds.x = x;
+   pending->bounds.y = y;
+   pending->bounds.width = width;
+   pending->bounds.height = height;
+}
+
+/**
+ * @param type type of notification
+ * @param min_interval minimal time in seconds between two notifications of
+ * given type for one object, 0 for no limit
+ * @param max_per_flush maximal number of notifications of given type emitted
+ * in one main loop iteration, 0 for no limit
+ */
+void
+eail_events_rate_limit_set(EailEventsType type,
+                           double min_interval,
+                           unsigned int max_per_flush)
+{
+   g_return_if_fail(type < EAIL_EVENTS_LAST);
+
+   _eail_events_limits[type].min_interval = min_interval;
+   _eail_events_limits[type].max_per_flush = max_per_flush;
+}
+
+/**
+ * @param accessible an AtkObject
+ */
+void
+eail_events_cancel(AtkObject *accessible)
+{
+   EailEventsPending *pending;
+
+   if (!_eail_events_pending) return;
+
+   pending = eina_hash_find(_eail_events_pending, &accessible);
+   if (!pending || !pending->queued) return;
+
+   pending->types = 0;
+   pending->queued = EINA_FALSE;
+   _eail_events_queue = eina_list_remove(_eail_events_queue, pending);
+}
+
+/**
+ * @brief Removes weak reference kept by pending entry
+ *
+ * @param hash hash table of pending entries
+ * @param key key of entry
+ * @param data an EailEventsPending
+ * @param fdata not used
+ * @return EINA_TRUE to continue iteration
+ */
+static Eina_Bool
+_eail_events_pending_unref(const Eina_Hash *hash, const void *key,
+                           void *data, void *fdata)
+{
+   EailEventsPending *pending = data;
+
+   g_object_weak_unref(G_OBJECT(pending->accessible),
+                       _eail_events_weak_notify, NULL);
+
+   return EINA_TRUE;
+}
+
+/**
+ * Should be called when EAIL module is unloaded.
+ */
+void
+eail_events_shutdown(void)
+{
+   if (_eail_events_flusher)
+     {
+        ecore_idle_enterer_del(_eail_events_flusher);
+        _eail_events_flusher = NULL;
+     }
+
+   if (_eail_events_timer)
+     {
+        ecore_timer_del(_eail_events_timer);
+        _eail_events_timer = NULL;
+     }
+
+   eina_list_free(_eail_events_queue);
+   _eail_events_queue = NULL;
+
+   if (_eail_events_pending)
+     {
+        eina_hash_foreach(_eail_events_pending, _eail_events_pending_unref,
+                          NULL);
+        eina_hash_free(_eail_events_pending);
+        _eail_events_pending = NULL;
+     }
+}
+
+/**
+ * @brief Callback for widget show and hide events
+ *
+ * @param data an AtkObject
+ * @param e an Evas
+ * @param obj shown or hidden widget
+ * @param event_info additional event info (not used here)
+ */
+static void
+_eail_events_on_visibility(void *data, Evas *e, Evas_Object *obj,
+                           void *event_info)
+{
+   gboolean visible = evas_object_visible_get(obj) ? TRUE : FALSE;
+
+   atk_object_notify_state_change(ATK_OBJECT(data), ATK_STATE_VISIBLE,
+                                  visible);
+   atk_object_notify_state_change(ATK_OBJECT(data), ATK_STATE_SHOWING,
+                                  visible);
+}
+
+/**
+ * @brief Callback for widget move and resize events
+ *
+ * @param data an AtkObject
+ * @param e an Evas
+ * @param obj moved or resized widget
+ * @param event_info additional event info (not used here)
+ */
+static void
+_eail_events_on_geometry(void *data, Evas *e, Evas_Object *obj,
+                         void *event_info)
+{
+   int x, y, width, height;
+
+   evas_object_geometry_get(obj, &x, &y, &width, &height);
+   eail_events_queue_bounds(ATK_OBJECT(data), x, y, width, height);
+}
+
+/**
+ * @brief Callback for "changed" smart signal of widget
+ *
+ * Text widgets use their content as accessible name, so the name is reported
+ * as changed for them as well as value for widgets implementing AtkValue.
+ * Notifications are queued, so bursts of changes cost one notification.
+ *
+ * @param data an AtkObject
+ * @param obj changed widget
+ * @param event_info additional event info (not used here)
+ */
+static void
+_eail_events_on_changed(void *data, Evas_Object *obj, void *event_info)
+{
+   AtkObject *accessible = ATK_OBJECT(data);
+
+   if (ATK_IS_TEXT(accessible))
+     eail_events_queue(accessible, EAIL_EVENTS_NAME_CHANGED);
+
+   if (ATK_IS_VALUE(accessible))
+     eail_events_queue(accessible, EAIL_EVENTS_VALUE_CHANGED);
+
+   eail_events_queue(accessible, EAIL_EVENTS_VISIBLE_DATA_CHANGED);
+}
+
+/**
+ * Callbacks are removed together with widget, accessible object lives at
+ * least as long as the widget.
+ *
+ * @param accessible an AtkObject representing widget
+ * @param widget an Evas_Object
+ */
+void
+eail_events_track_widget(AtkObject *accessible, Evas_Object *widget)
+{
+   g_return_if_fail(ATK_IS_OBJECT(accessible));
+   g_return_if_fail(widget);
+
+   evas_object_event_callback_add(widget, EVAS_CALLBACK_SHOW,
+                                  _eail_events_on_visibility, accessible);
+   evas_object_event_callback_add(widget, EVAS_CALLBACK_HIDE,
+                                  _eail_events_on_visibility, accessible);
+   evas_object_event_callback_add(widget, EVAS_CALLBACK_MOVE,
+                                  _eail_events_on_geometry, accessible);
+   evas_object_event_callback_add(widget, EVAS_CALLBACK_RESIZE,
+                                  _eail_events_on_geometry, accessible);
+   evas_object_smart_callback_add(widget, EAIL_EVENTS_CHANGED_NAME,
+                                  _eail_events_on_changed, accessible);
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_events.h
+ */
+
+#ifndef EAIL_EVENTS_H
+#define EAIL_EVENTS_H
+
+#include <atk/atk.h>
+#include <Evas.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Types of notifications merged by event queue
+ */
+typedef enum
+{
+   EAIL_EVENTS_BOUNDS_CHANGED,      /**< bounds-changed signal */
+   EAIL_EVENTS_VISIBLE_DATA_CHANGED,/**< visible-data-changed signal */
+   EAIL_EVENTS_NAME_CHANGED,        /**< accessible-name property change */
+   EAIL_EVENTS_VALUE_CHANGED,       /**< accessible-value property change */
+   EAIL_EVENTS_LAST                 /**< number of queued event types */
+} EailEventsType;
+
+/**
+ * @brief Connects Evas/Elementary callbacks of widget to ATK signals emitted
+ * on its accessible
+ */
+void eail_events_track_widget(AtkObject *accessible, Evas_Object *widget);
+
+/**
+ * @brief Emits children-changed::add or children-changed::remove signal
+ */
+void eail_events_children_changed(AtkObject *parent,
+                                  gboolean added,
+                                  gint index,
+                                  AtkObject *child);
+
+/**
+ * @brief Emits bounds-changed signal with given extents
+ */
+void eail_events_bounds_changed(AtkObject *accessible,
+                                gint x,
+                                gint y,
+                                gint width,
+                                gint height);
+
+/**
+ * @brief Emits visible-data-changed signal
+ */
+void eail_events_visible_data_changed(AtkObject *accessible);
+
+/**
+ * @brief Emits property-change signal for given AtkObject property
+ */
+void eail_events_property_changed(AtkObject *accessible,
+                                  const gchar *property);
+
+/**
+ * @brief Queues notification of given type to be emitted on next main loop
+ * iteration
+ */
+void eail_events_queue(AtkObject *accessible, EailEventsType type);
+
+/**
+ * @brief Queues bounds-changed notification with given extents
+ */
+void eail_events_queue_bounds(AtkObject *accessible,
+                              gint x,
+                              gint y,
+                              gint width,
+                              gint height);
+
+/**
+ * @brief Sets rate limits for queued notifications of given type
+ */
+void eail_events_rate_limit_set(EailEventsType type,
+                                double min_interval,
+                                unsigned int max_per_flush);
+
+/**
+ * @brief Drops notifications queued for given AtkObject
+ */
+void eail_events_cancel(AtkObject *accessible);
+
+/**
+ * @brief Drops all queued notifications and frees event queue
+ */
+void eail_events_shutdown(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
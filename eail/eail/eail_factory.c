@@ -25,6 +25,7 @@
 #include <Elementary.h>
 
 #include "eail_factory.h"
+#include "eail_events.h"
 #include "eail_widget.h"
 #include "eail_window.h"
 #include "eail_background.h"
@@ -90,284 +91,183 @@
 #include "eail_priv.h"
 
 /**
- * @param widget an Evas_Object*
+ * @brief Key under which accessible object is stored in Evas_Object data
+ */
+#define EAIL_FACTORY_ACCESSIBLE_KEY "eail_accessible"
+
+typedef struct _EailFactoryType EailFactoryType;
+
+/** @struct Mapping between elementary widget type and EAIL accessible type
+ */
+struct _EailFactoryType
+{
+   const char *widget_type;/*!< \brief type returned by elm_object_widget_type_get */
+   GType (*get_type)(void);/*!< \brief getter of EAIL accessible GType */
+};
+
+/**
+ * @brief Accessible types for widgets supported by EAIL out of the box
+ */
+static const EailFactoryType eail_factory_builtin_types[] =
+{
+   {"elm_win", eail_window_get_type},
+   {"elm_bg", eail_background_get_type},
+   {"elm_box", eail_box_get_type},
+   {"elm_list", eail_list_get_type},
+   {"elm_genlist", eail_genlist_get_type},
+   {"elm_label", eail_label_get_type},
+   {"elm_button", eail_button_get_type},
+   {"elm_icon", eail_icon_get_type},
+   {"entry", eail_entry_get_type},
+   {"elm_entry", eail_entry_get_type},
+   {"elm_frame", eail_frame_get_type},
+   {"elm_scroller", eail_scroller_get_type},
+   {"elm_inwin", eail_inwin_get_type},
+   {"elm_slider", eail_slider_get_type},
+   {"elm_actionslider", eail_action_slider_get_type},
+   {"elm_image", eail_image_get_type},
+   {"elm_check", eail_check_get_type},
+   {"elm_radio", eail_radio_button_get_type},
+   {"elm_menu", eail_menu_get_type},
+   {"elm_photo", eail_photo_get_type},
+   {"elm_photocam", eail_photocam_get_type},
+   {"elm_separator", eail_separator_get_type},
+   {"elm_spinner", eail_spinner_get_type},
+   {"elm_clock", eail_clock_get_type},
+   {"elm_calendar", eail_calendar_get_type},
+   {"elm_grid", eail_grid_get_type},
+   {"elm_route", eail_route_get_type},
+   {"elm_dayselector", eail_dayselector_get_type},
+   {"elm_gengrid", eail_gengrid_get_type},
+   {"elm_progressbar", eail_progressbar_get_type},
+   {"elm_diskselector", eail_disk_selector_get_type},
+   {"elm_segment_control", eail_segment_control_get_type},
+   {"elm_conformant", eail_conformant_get_type},
+   {"elm_notify", eail_notify_get_type},
+   {"popup", eail_popup_get_type},
+   {"elm_popup", eail_popup_get_type},
+   {"ctxpopup", eail_ctxpopup_get_type},
+   {"elm_ctxpopup", eail_ctxpopup_get_type},
+   {"toolbar", eail_toolbar_get_type},
+   {"elm_toolbar", eail_toolbar_get_type},
+   {"elm_multibuttonentry", eail_multibuttonentry_get_type},
+   {"elm_web", eail_web_get_type},
+   {"elm_index", eail_index_get_type},
+   {"elm_fileselector", eail_fileselector_get_type},
+   {"elm_fileselector_entry", eail_fileselector_entry_get_type},
+   {"fileselector_entry", eail_fileselector_entry_get_type},
+   /* NOTE: file selector button from accesibility point of view is
+    * no different in handling than regular push button */
+   {"elm_fileselector_button", eail_button_get_type},
+   {"elm_colorselector", eail_colorselector_get_type},
+   {"elm_naviframe", eail_naviframe_get_type},
+   {"elm_datetime", eail_datetime_get_type},
+   {"elm_hover", eail_hover_get_type},
+   {"elm_panes", eail_panes_get_type},
+   {"panel", eail_panel_get_type},
+   {"elm_panel", eail_panel_get_type},
+   {"elm_thumb", eail_thumb_get_type},
+   {"elm_mapbuf", eail_mapbuf_get_type},
+   {"elm_slideshow", eail_slideshow_get_type},
+   {"elm_hoversel", eail_hoversel_get_type},
+   {"elm_map", eail_map_get_type},
+   {"elm_glview", eail_glview_get_type},
+   {"elm_bubble", eail_bubble_get_type},
+   {"elm_plug", eail_plug_get_type},
+   {"elm_video", eail_video_get_type},
+   {"elm_player", eail_video_get_type},
+   {"elm_flip", eail_flip_get_type},
+   {"elm_flipselector", eail_flipselector_get_type},
+   {"elm_layout", eail_layout_get_type},
+   {"elm_table", eail_table_get_type},
+   {"elm_prefs", eail_prefs_get_type},
+   {NULL, NULL}
+};
+
+/**
+ * @brief Registry of accessible types keyed by widget type name
+ */
+static Eina_Hash *eail_factory_types = NULL;
+
+/**
+ * @brief Fills registry of accessible types with built-in EAIL widgets
  *
- * @returns reference to AtkObject* which is accessible representation of given
- * Evas_Object. It should be unreferenced when no longer needed to free memory
+ * Does nothing if registry has been already created.
  */
-AtkObject *
-eail_factory_get_accessible(Evas_Object *widget)
+void
+eail_factory_init(void)
+{
+   const EailFactoryType *t;
+
+   if (eail_factory_types) return;
+
+   eail_factory_types = eina_hash_string_superfast_new(NULL);
+   for (t = eail_factory_builtin_types; t->widget_type; ++t)
+     eina_hash_add(eail_factory_types, t->widget_type,
+                   GSIZE_TO_POINTER(t->get_type()));
+}
+
+/**
+ * @brief Frees registry of accessible types
+ */
+void
+eail_factory_shutdown(void)
+{
+   if (!eail_factory_types) return;
+
+   eina_hash_free(eail_factory_types);
+   eail_factory_types = NULL;
+}
+
+/**
+ * Registered type will be used for every widget of given type that has no
+ * accessible created yet. Registering already known widget type overrides
+ * previous mapping, so built-in accessibles can be replaced as well.
+ *
+ * @param widget_type widget type as returned by elm_object_widget_type_get
+ * @param type GType of accessible, it has to be derived from EAIL_TYPE_WIDGET
+ *
+ * @returns TRUE if type was registered, FALSE otherwise
+ */
+gboolean
+eail_factory_register_type(const char *widget_type, GType type)
+{
+   g_return_val_if_fail(widget_type, FALSE);
+   g_return_val_if_fail(g_type_is_a(type, EAIL_TYPE_WIDGET), FALSE);
+
+   eail_factory_init();
+   eina_hash_set(eail_factory_types, widget_type, GSIZE_TO_POINTER(type));
+
+   return TRUE;
+}
+
+/**
+ * @brief Creates new accessible object for given widget
+ *
+ * @param widget an Evas_Object* that is elementary widget
+ *
+ * @returns newly created and initialized AtkObject* for given widget
+ */
+static AtkObject *
+_eail_factory_create_accessible(Evas_Object *widget)
 {
    const char *type = NULL;
    AtkObject *accessible = NULL;
+   GType accessible_type;
 
-   if (!elm_object_widget_check(widget))
-     {
-        DBG("%s is NOT elementary object widget!",
-            evas_object_type_get(widget));
-        return NULL;
-     }
+   eail_factory_init();
 
    type = elm_object_widget_type_get(widget);
+   accessible_type = GPOINTER_TO_SIZE(eina_hash_find(eail_factory_types, type));
 
-   if (!strcmp(type, "elm_win"))
-     {
-        accessible = g_object_new(EAIL_TYPE_WINDOW, NULL);
-     }
-   else if (!strcmp(type, "elm_bg"))
-     {
-        accessible = g_object_new(EAIL_TYPE_BACKGROUND, NULL);
-     }
-   else if (!strcmp(type, "elm_box"))
-     {
-        accessible = g_object_new(EAIL_TYPE_BOX, NULL);
-     }
-   else if (!strcmp(type, "elm_list"))
-     {
-        accessible = g_object_new(EAIL_TYPE_LIST, NULL);
-     }
-   else if (!strcmp(type, "elm_genlist"))
-     {
-        accessible = g_object_new(EAIL_TYPE_GENLIST, NULL);
-     }
-   else if (!strcmp(type, "elm_label"))
-     {
-        accessible = g_object_new(EAIL_TYPE_LABEL, NULL);
-     }
-   else if (!strcmp(type, "elm_button"))
-     {
-        accessible = g_object_new(EAIL_TYPE_BUTTON, NULL);
-     }
-   else if (!strcmp(type, "elm_icon"))
-     {
-        accessible = g_object_new(EAIL_TYPE_ICON, NULL);
-     }
-   else if ((!strcmp(type, "entry")) || (!strcmp(type, "elm_entry")))
-     {
-        accessible = g_object_new(EAIL_TYPE_ENTRY, NULL);
-     }
-   else if (!strcmp(type, "elm_frame"))
-     {
-        accessible = g_object_new(EAIL_TYPE_FRAME, NULL);
-     }
-   else if (!strcmp(type, "elm_scroller"))
-     {
-        accessible = g_object_new(EAIL_TYPE_SCROLLER, NULL);
-     }
-   else if (!strcmp(type, "elm_inwin"))
-     {
-        accessible = g_object_new(EAIL_TYPE_INWIN, NULL);
-     }
-   else if (!strcmp(type, "elm_slider"))
-     {
-        accessible = g_object_new(EAIL_TYPE_SLIDER, NULL);
-     }
-   else if (!strcmp(type, "elm_actionslider"))
-     {
-        accessible = g_object_new(EAIL_TYPE_ACTION_SLIDER, NULL);
-     }
-   else if (!strcmp(type, "elm_image"))
-     {
-        accessible = g_object_new(EAIL_TYPE_IMAGE, NULL);
-     }
-   else if (!strcmp(type, "elm_check"))
-     {
-        accessible = g_object_new(EAIL_TYPE_CHECK, NULL);
-     }
-   else if (!strcmp(type, "elm_radio"))
-     {
-        accessible = g_object_new(EAIL_TYPE_RADIO_BUTTON, NULL);
-     }
-   else if (!strcmp(type, "elm_menu"))
-     {
-        accessible = g_object_new(EAIL_TYPE_MENU, NULL);
-     }
-   else if (!strcmp(type, "elm_photo"))
-     {
-        accessible = g_object_new(EAIL_TYPE_PHOTO, NULL);
-     }
-   else if (!strcmp(type, "elm_photocam"))
-     {
-        accessible = g_object_new(EAIL_TYPE_PHOTOCAM, NULL);
-     }
-   else if (!strcmp(type, "elm_separator"))
-     {
-        accessible = g_object_new(EAIL_TYPE_SEPARATOR, NULL);
-     }
-   else if (!strcmp(type, "elm_spinner"))
-     {
-        accessible = g_object_new(EAIL_TYPE_SPINNER, NULL);
-     }
-   else if (!strcmp(type, "elm_clock"))
-     {
-        accessible = g_object_new(EAIL_TYPE_CLOCK, NULL);
-     }
-   else if (!strcmp(type, "elm_calendar"))
-     {
-        accessible = g_object_new(EAIL_TYPE_CALENDAR, NULL);
-     }
-   else if (!strcmp(type, "elm_grid"))
-     {
-        accessible = g_object_new(EAIL_TYPE_GRID, NULL);
-     }
-   else if (!strcmp(type, "elm_route"))
-     {
-        accessible = g_object_new(EAIL_TYPE_ROUTE, NULL);
-     }
-   else if (!strcmp(type, "elm_dayselector"))
-     {
-        accessible = g_object_new(EAIL_TYPE_DAYSELECTOR, NULL);
-     }
-   else if (!strcmp(type, "elm_gengrid"))
-     {
-        accessible = g_object_new(EAIL_TYPE_GENGRID, NULL);
-     }
-   else if (!strcmp(type, "elm_progressbar"))
-     {
-        accessible = g_object_new(EAIL_TYPE_PROGRESSBAR, NULL);
-     }
-   else if (!strcmp(type, "elm_diskselector"))
-     {
-        accessible = g_object_new(EAIL_TYPE_DISK_SELECTOR, NULL);
-     }
-   else if (!strcmp(type, "elm_segment_control"))
-     {
-        accessible = g_object_new(EAIL_TYPE_SEGMENT_CONTROL, NULL);
-     }
-   else if (!strcmp(type, "elm_conformant"))
-     {
-        accessible = g_object_new(EAIL_TYPE_CONFORMANT, NULL);
-     }
-   else if (!strcmp(type, "elm_notify"))
-     {
-        accessible = g_object_new(EAIL_TYPE_NOTIFY, NULL);
-     }
-   else if ((!strcmp(type, "popup")) || (!strcmp(type, "elm_popup")))
-     {
-        accessible = g_object_new(EAIL_TYPE_POPUP, NULL);
-     }
-   else if ((!strcmp(type, "ctxpopup")) || ((!strcmp(type, "elm_ctxpopup"))))
-     {
-        accessible = g_object_new(EAIL_TYPE_CTXPOPUP, NULL);
-     }
-   else if ((!strcmp(type, "toolbar")) || (!strcmp(type, "elm_toolbar")))
-     {
-        accessible = g_object_new(EAIL_TYPE_TOOLBAR, NULL);
-     }
-   else if (!strcmp(type, "elm_multibuttonentry"))
-     {
-        accessible = g_object_new(EAIL_TYPE_MULTIBUTTONENTRY, NULL);
-     }
-   else if (!strcmp(type, "elm_web"))
-     {
-        accessible = g_object_new(EAIL_TYPE_WEB, NULL);
-     }
-   else if (!strcmp(type, "elm_index"))
-     {
-        accessible = g_object_new(EAIL_TYPE_INDEX, NULL);
-     }
-   else if (!strcmp(type, "elm_fileselector"))
-     {
-        accessible = g_object_new(EAIL_TYPE_FILESELECTOR, NULL);
-     }
-   else if ((!strcmp(type, "elm_fileselector_entry")) ||
-            (!strcmp(type, "fileselector_entry")))
-     {
-        accessible = g_object_new(EAIL_TYPE_FILESELECTOR_ENTRY, NULL);
-     }
-   else if (!strcmp(type, "elm_fileselector_button"))
-     {
-        /* NOTE: file selector button from accesibility point of view is
-         * no different in handling than regular push button */
-        accessible = g_object_new(EAIL_TYPE_BUTTON, NULL);
-     }
-   else if (!strcmp(type, "elm_colorselector"))
-     {
-        accessible = g_object_new(EAIL_TYPE_COLORSELECTOR, NULL);
-     }
-   else if (!strcmp(type, "elm_naviframe"))
-     {
-        accessible = g_object_new(EAIL_TYPE_NAVIFRAME, NULL);
-     }
-   else if (!strcmp(type, "elm_datetime"))
-     {
-        accessible = g_object_new(EAIL_TYPE_DATETIME, NULL);
-     }
-   else if (!strcmp(type, "elm_hover"))
-     {
-        accessible = g_object_new(EAIL_TYPE_HOVER, NULL);
-     }
-   else if (!strcmp(type, "elm_panes"))
-     {
-        accessible = g_object_new(EAIL_TYPE_PANES, NULL);
-     }
-   else if ((!strcmp(type, "panel")) || (!strcmp(type, "elm_panel")))
-     {
-        accessible = g_object_new(EAIL_TYPE_PANEL, NULL);
-     }
-   else if (!strcmp(type, "elm_thumb"))
-     {
-        accessible = g_object_new(EAIL_TYPE_THUMB, NULL);
-     }
-   else if (!strcmp(type, "elm_mapbuf"))
-     {
-        accessible = g_object_new(EAIL_TYPE_MAPBUF, NULL);
-     }
-   else if (!strcmp(type, "elm_slideshow"))
-     {
-        accessible = g_object_new(EAIL_TYPE_SLIDESHOW, NULL);
-     }
-   else if (!strcmp(type, "elm_hoversel"))
-     {
-        accessible = g_object_new(EAIL_TYPE_HOVERSEL, NULL);
-     }
-   else if (!strcmp(type, "elm_map"))
-     {
-        accessible = g_object_new(EAIL_TYPE_MAP, NULL);
-     }
-   else if (!strcmp(type, "elm_glview"))
-     {
-        accessible = g_object_new(EAIL_TYPE_GLVIEW, NULL);
-     }
-   else if (!strcmp(type, "elm_bubble"))
-     {
-        accessible = g_object_new(EAIL_TYPE_BUBBLE, NULL);
-     }
-   else if (!strcmp(type, "elm_plug"))
-     {
-        accessible = g_object_new(EAIL_TYPE_PLUG, NULL);
-     }
-   else if ((!strcmp(type, "elm_video")) || (!strcmp(type, "elm_player")))
-     {
-        accessible = g_object_new(EAIL_TYPE_VIDEO, NULL);
-     }
-   else if (!strcmp(type, "elm_flip"))
-     {
-        accessible = g_object_new(EAIL_TYPE_FLIP, NULL);
-     }
-   else if (!strcmp(type, "elm_flipselector"))
-     {
-        accessible = g_object_new(EAIL_TYPE_FLIPSELECTOR, NULL);
-     }
-   else if (!strcmp(type, "elm_layout"))
-     {
-        accessible = g_object_new(EAIL_TYPE_LAYOUT, NULL);
-     }
-   else if (!strcmp(type, "elm_table"))
-     {
-        accessible = g_object_new(EAIL_TYPE_TABLE, NULL);
-     }
-   else if (!strcmp(type, "elm_prefs"))
-     {
-        accessible = g_object_new(EAIL_TYPE_PREFS, NULL);
-     }
-   else
+   if (!accessible_type)
      {
         DBG("Unrecognized specific widget type: %s", type);
         DBG("Creating basic widget with NULL type.");
-        accessible = g_object_new(EAIL_TYPE_WIDGET, NULL);
+        accessible_type = EAIL_TYPE_WIDGET;
      }
 
+   accessible = g_object_new(accessible_type, NULL);
    if (accessible)
      {
         atk_object_initialize(accessible, widget);
@@ -375,3 +275,85 @@ eail_factory_get_accessible(Evas_Object *widget)
 
    return accessible;
 }
+
+/**
+ * @brief Callback used to release accessible object when widget is deleted
+ *
+ * Nested widget pointer is cleared so that accessible object, which may still
+ * be referenced by ATK clients, reports itself as defunct from now on.
+ *
+ * @param data an AtkObject* cached for widget
+ * @param e an Evas
+ * @param obj deleted Evas_Object
+ * @param event_info additional event info (not used here)
+ */
+static void
+_eail_factory_on_widget_del(void *data,
+                            Evas *e,
+                            Evas_Object *obj,
+                            void *event_info)
+{
+   AtkObject *accessible = ATK_OBJECT(data);
+
+   evas_object_data_del(obj, EAIL_FACTORY_ACCESSIBLE_KEY);
+
+   if (EAIL_IS_WIDGET(accessible))
+     {
+        eail_widget_invalidate_children(EAIL_WIDGET(accessible));
+        EAIL_WIDGET(accessible)->widget = NULL;
+     }
+
+   eail_events_cancel(accessible);
+   atk_object_notify_state_change(accessible, ATK_STATE_DEFUNCT, TRUE);
+   g_object_unref(accessible);
+}
+
+/**
+ * @param widget an Evas_Object*
+ *
+ * @returns AtkObject* already created for given widget or NULL if there is
+ * none. Returned reference is owned by the widget
+ */
+AtkObject *
+eail_factory_find_accessible(Evas_Object *widget)
+{
+   if (!widget) return NULL;
+
+   return evas_object_data_get(widget, EAIL_FACTORY_ACCESSIBLE_KEY);
+}
+
+/**
+ * Accessible object is created only once for every widget. It is stored in
+ * widget data and released when widget is deleted, so subsequent calls for
+ * the same widget return the same object without allocating anything.
+ *
+ * @param widget an Evas_Object*
+ *
+ * @returns AtkObject* which is accessible representation of given
+ * Evas_Object. Returned reference is owned by the widget, so call
+ * g_object_ref on it when it is passed to the caller as a new reference
+ */
+AtkObject *
+eail_factory_get_accessible(Evas_Object *widget)
+{
+   AtkObject *accessible = NULL;
+
+   if (!elm_object_widget_check(widget))
+     {
+        DBG("%s is NOT elementary object widget!",
+            evas_object_type_get(widget));
+        return NULL;
+     }
+
+   accessible = evas_object_data_get(widget, EAIL_FACTORY_ACCESSIBLE_KEY);
+   if (accessible) return accessible;
+
+   accessible = _eail_factory_create_accessible(widget);
+   if (!accessible) return NULL;
+
+   evas_object_data_set(widget, EAIL_FACTORY_ACCESSIBLE_KEY, accessible);
+   evas_object_event_callback_add(widget, EVAS_CALLBACK_DEL,
+                                  _eail_factory_on_widget_del, accessible);
+
+   return accessible;
+}
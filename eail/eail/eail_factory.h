@@ -33,10 +33,37 @@ extern "C" {
 #endif
 
 /**
- * @brief Creates accessible EAIL widget that is represents given Evas_Object*
+ * @brief Gets accessible EAIL widget that represents given Evas_Object*
+ *
+ * Accessible is created on first request and cached on the widget until the
+ * widget is deleted. Returned reference is owned by the widget.
  */
 AtkObject * eail_factory_get_accessible    (Evas_Object *widget);
 
+/**
+ * @brief Gets accessible already created for given Evas_Object* without
+ * creating new one
+ */
+AtkObject * eail_factory_find_accessible   (Evas_Object *widget);
+
+/**
+ * @brief Registers accessible type used for given elementary widget type
+ *
+ * Allows applications to provide accessibles for their own custom widgets
+ */
+gboolean    eail_factory_register_type     (const char *widget_type,
+                                            GType type);
+
+/**
+ * @brief Creates registry of accessible types for built-in widgets
+ */
+void        eail_factory_init              (void);
+
+/**
+ * @brief Frees registry of accessible types
+ */
+void        eail_factory_shutdown          (void);
+
 #ifdef __cplusplus
 }
 #endif
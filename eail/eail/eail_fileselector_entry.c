@@ -30,7 +30,8 @@
 #include "eail_priv.h"
 
 static void atk_text_interface_init(AtkTextIface *iface);
-static void eail_fileselector_entry_actions_init(EailActionWidget *widget);
+static void eail_fileselector_entry_actions_init
+                                          (EailFileselectorEntryClass *klass);
 
 #define ICON_CONTENT_NAME "button icon"
 #define EAIL_FSE_ACTION_CLICK "click"
@@ -63,11 +64,6 @@ eail_fileselector_entry_initialize(AtkObject *obj, gpointer data)
 {
    ATK_OBJECT_CLASS(eail_fileselector_entry_parent_class) ->initialize(obj, data);
    obj->role = ATK_ROLE_GROUPING;
-
-   EailActionWidget *action_widget = EAIL_ACTION_WIDGET(obj);
-
-   /* Initializing possible widget actions table*/
-   eail_fileselector_entry_actions_init(action_widget);
 }
 
 /**
@@ -203,6 +199,9 @@ eail_fileselector_entry_class_init(EailFileselectorEntryClass *klass)
    class->get_n_children = eail_fileselector_entry_get_n_children;
    class->ref_child = eail_fileselector_entry_ref_child;
    gobject_class->finalize = eail_fileselector_entry_finalize;
+
+   /* Initializing possible widget actions table*/
+   eail_fileselector_entry_actions_init(klass);
 }
 
 /*
@@ -386,21 +385,18 @@ eail_action_unpress(AtkAction *action, void *data)
 /**
  * @brief Adds fileselector actions to actions table
  *
- * @param action_widget widget that implements EailActionWidget interface
+ * @param klass EailFileselectorEntryClass
  */
 static void
-eail_fileselector_entry_actions_init(EailActionWidget *action_widget)
+eail_fileselector_entry_actions_init(EailFileselectorEntryClass *klass)
 {
-   eail_action_widget_action_append(action_widget,
-                                    EAIL_FSE_ACTION_CLICK, NULL,
-                                    eail_action_click);
-   eail_action_widget_action_append(action_widget,
-                                    EAIL_FSE_ACTION_LONGPRESS, NULL,
-                                    eail_action_longpress);
-   eail_action_widget_action_append(action_widget,
-                                    EAIL_FSE_ACTION_PRESS, NULL,
-                                    eail_action_press);
-   eail_action_widget_action_append(action_widget,
-                                    EAIL_FSE_ACTION_UNPRESS, NULL,
-                                    eail_action_unpress);
+   static const EailActionDef actions[] = {
+        {EAIL_FSE_ACTION_CLICK, NULL, eail_action_click},
+        {EAIL_FSE_ACTION_LONGPRESS, NULL, eail_action_longpress},
+        {EAIL_FSE_ACTION_PRESS, NULL, eail_action_press},
+        {EAIL_FSE_ACTION_UNPRESS, NULL, eail_action_unpress}
+   };
+
+   eail_action_widget_class_actions_append(EAIL_ACTION_WIDGET_CLASS(klass),
+                                           actions, G_N_ELEMENTS(actions));
 }
@@ -43,21 +43,476 @@ G_DEFINE_TYPE_WITH_CODE(EailGengrid,
                         G_IMPLEMENT_INTERFACE(ATK_TYPE_SELECTION,
                                               atk_selection_interface_init))
 
+#define EAIL_GENGRID_REALIZED_NAME "realized"
+#define EAIL_GENGRID_MOVED_NAME "moved"
+#define EAIL_GENGRID_SELECTED_NAME "selected"
+#define EAIL_GENGRID_UNSELECTED_NAME "unselected"
+
 /**
- * @brief Get list of created widgets
+ * @brief Drops selected items counts, they will be counted again on next
+ * request
  *
  * @param gengrid EailGengrid instance
+ */
+static void
+eail_gengrid_selection_invalidate(EailGengrid *gengrid)
+{
+   if (!gengrid->row_selected) return;
+
+   g_array_free(gengrid->row_selected, TRUE);
+   g_array_free(gengrid->column_selected, TRUE);
+   gengrid->row_selected = NULL;
+   gengrid->column_selected = NULL;
+   eina_hash_free_buckets(gengrid->selected);
+}
+
+/**
+ * @brief Drops items map, it will be walked again on next request
+ *
+ * @param gengrid EailGengrid instance
+ */
+static void
+eail_gengrid_items_invalidate(EailGengrid *gengrid)
+{
+   eail_gengrid_selection_invalidate(gengrid);
+   eina_array_clean(gengrid->items);
+   eina_hash_free_buckets(gengrid->items_index);
+}
+
+/**
+ * @brief Appends item and all items following it to items map
+ *
+ * Appended items are watched, so they are removed from the map when deleted,
+ * see eail_gengrid_item_deleted.
  *
- * @returns list of widgets elm_gengrid holds
+ * @param gengrid EailGengrid instance
+ * @param it first item to append
  */
-static Eina_List *
-eail_gengrid_items_get(EailGengrid *gengrid)
+static void
+eail_gengrid_items_append_from(EailGengrid *gengrid, Elm_Object_Item *it)
 {
-   g_return_val_if_fail(EAIL_IS_WIDGET(gengrid), NULL);
+   for (; it; it = elm_gengrid_item_next_get(it))
+     {
+        eina_array_push(gengrid->items, it);
+        eina_hash_add(gengrid->items_index, &it,
+                      GUINT_TO_POINTER(eina_array_count(gengrid->items)));
+        eail_item_parent_watch_item(it);
+     }
+}
 
+/**
+ * @brief Brings items map in sync with gengrid
+ *
+ * Deleted items are removed from the map as they are deleted, so it always
+ * holds live items in gengrid order and misses only inserted ones. Map is
+ * therefore complete when items count matches, items appended at the end are
+ * mapped in place and items inserted elsewhere make it walk all items again.
+ *
+ * @param gengrid EailGengrid instance
+ * @param widget elm_gengrid instance
+ */
+static void
+eail_gengrid_items_validate(EailGengrid *gengrid, Evas_Object *widget)
+{
+   unsigned int count = elm_gengrid_items_count(widget);
+   unsigned int n = eina_array_count(gengrid->items);
+   Elm_Object_Item *it;
+
+   if (n == count) return;
+
+   /* cells of selected items may move, whatever changed */
+   eail_gengrid_selection_invalidate(gengrid);
+
+   if (n && count > n)
+     {
+        it = elm_gengrid_last_item_get(widget);
+        for (unsigned int i = count; i > n && it; i--)
+          it = elm_gengrid_item_prev_get(it);
+
+        if (it == eina_array_data_get(gengrid->items, n - 1))
+          {
+             eail_gengrid_items_append_from(gengrid,
+                                            elm_gengrid_item_next_get(it));
+             return;
+          }
+     }
+
+   eail_gengrid_items_invalidate(gengrid);
+   eail_gengrid_items_append_from(gengrid, elm_gengrid_first_item_get(widget));
+}
+
+/**
+ * @brief Gets gengrid item at given index
+ *
+ * @param gengrid EailGengrid instance
+ * @param i index of item
+ *
+ * @returns item or NULL if there is no item at given index
+ */
+static Elm_Object_Item *
+eail_gengrid_item_nth(EailGengrid *gengrid, gint i)
+{
    Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(gengrid));
 
-   return elm_gengrid_realized_items_get(widget);
+   if (!widget || i < 0) return NULL;
+
+   eail_gengrid_items_validate(gengrid, widget);
+   if (i >= eina_array_count(gengrid->items)) return NULL;
+
+   return eina_array_data_get(gengrid->items, i);
+}
+
+/**
+ * @brief Gets index of gengrid item
+ *
+ * @param gengrid EailGengrid instance
+ * @param it gengrid item
+ *
+ * @returns index of item or -1 if item was not found
+ */
+static gint
+eail_gengrid_item_index(EailGengrid *gengrid, Elm_Object_Item *it)
+{
+   Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(gengrid));
+
+   if (!widget || !it) return -1;
+
+   eail_gengrid_items_validate(gengrid, widget);
+
+   return GPOINTER_TO_INT(eina_hash_find(gengrid->items_index, &it)) - 1;
+}
+
+/**
+ * @brief Gets number of items in one row (one column in horizontal mode)
+ *
+ * It is taken from positions of realized items, so it matches what gengrid
+ * has laid out. Before anything is realized it is guessed from geometry.
+ *
+ * @param gengrid EailGengrid instance
+ * @param widget elm_gengrid instance
+ *
+ * @returns number of items in one line, at least 1
+ */
+static unsigned int
+eail_gengrid_per_line_get(EailGengrid *gengrid, Evas_Object *widget)
+{
+   Eina_Bool horizontal = elm_gengrid_horizontal_get(widget);
+   Eina_List *list;
+   Elm_Object_Item *it;
+
+   if (gengrid->per_line && gengrid->horizontal == horizontal)
+     return gengrid->per_line;
+
+   eail_gengrid_selection_invalidate(gengrid);
+   gengrid->horizontal = horizontal;
+   gengrid->per_line = 0;
+
+   list = elm_gengrid_realized_items_get(widget);
+   EINA_LIST_FREE(list, it)
+     {
+        unsigned int x, y;
+
+        elm_gengrid_item_pos_get(it, &x, &y);
+        gengrid->per_line = MAX(gengrid->per_line, (horizontal ? y : x) + 1);
+     }
+
+   if (!gengrid->per_line)
+     {
+        Evas_Coord w, h, item_w, item_h;
+
+        evas_object_geometry_get(widget, NULL, NULL, &w, &h);
+        elm_gengrid_item_size_get(widget, &item_w, &item_h);
+        if (horizontal && item_h > 0)
+          gengrid->per_line = h / item_h;
+        else if (!horizontal && item_w > 0)
+          gengrid->per_line = w / item_w;
+     }
+
+   if (!gengrid->per_line)
+     gengrid->per_line = 1;
+
+   return gengrid->per_line;
+}
+
+/**
+ * @brief Helper function to turn index into table position with current
+ * line length
+ *
+ * @param gengrid EailGengrid instance
+ * @param index index of item
+ * @param row address to store row number
+ * @param column address to store column number
+ */
+static void
+_index_to_pos(EailGengrid *gengrid, gint index, gint *row, gint *column)
+{
+   if (gengrid->horizontal)
+     {
+        *row = index % gengrid->per_line;
+        *column = index / gengrid->per_line;
+     }
+   else
+     {
+        *row = index / gengrid->per_line;
+        *column = index % gengrid->per_line;
+     }
+}
+
+/**
+ * @brief Gets table position of item at given index
+ *
+ * @param gengrid EailGengrid instance
+ * @param index index of item
+ * @param row address to store row number
+ * @param column address to store column number
+ *
+ * @returns TRUE if there is an item at given index, FALSE otherwise
+ */
+static gboolean
+eail_gengrid_item_pos_get(EailGengrid *gengrid, gint index,
+                          gint *row, gint *column)
+{
+   Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(gengrid));
+
+   *row = -1;
+   *column = -1;
+
+   if (!eail_gengrid_item_nth(gengrid, index)) return FALSE;
+
+   eail_gengrid_per_line_get(gengrid, widget);
+   _index_to_pos(gengrid, index, row, column);
+
+   return TRUE;
+}
+
+/**
+ * @brief Adds or removes item from selected items counts
+ *
+ * Items map and line length have to be valid.
+ *
+ * @param gengrid EailGengrid instance
+ * @param it gengrid item
+ * @param selected EINA_TRUE to count item in, EINA_FALSE to count it out
+ */
+static void
+_count_selected(EailGengrid *gengrid, Elm_Object_Item *it, Eina_Bool selected)
+{
+   gint index, row, column;
+
+   if ((eina_hash_find(gengrid->selected, &it) != NULL) == selected) return;
+
+   index = GPOINTER_TO_INT(eina_hash_find(gengrid->items_index, &it)) - 1;
+   if (index < 0) return;
+
+   _index_to_pos(gengrid, index, &row, &column);
+   if (selected)
+     {
+        eina_hash_add(gengrid->selected, &it, it);
+        g_array_index(gengrid->row_selected, guint, row)++;
+        g_array_index(gengrid->column_selected, guint, column)++;
+     }
+   else
+     {
+        eina_hash_del_by_key(gengrid->selected, &it);
+        g_array_index(gengrid->row_selected, guint, row)--;
+        g_array_index(gengrid->column_selected, guint, column)--;
+     }
+}
+
+/**
+ * @brief Brings selected items counts in sync with gengrid
+ *
+ * Counts are taken from selected items list only when items or their
+ * layout have changed, otherwise they are kept up to date by selection
+ * callbacks.
+ *
+ * @param gengrid EailGengrid instance
+ * @param widget elm_gengrid instance
+ */
+static void
+eail_gengrid_selection_validate(EailGengrid *gengrid, Evas_Object *widget)
+{
+   const Eina_List *l;
+   Elm_Object_Item *it;
+   int rows, columns;
+
+   eail_gengrid_items_validate(gengrid, widget);
+   eail_gengrid_per_line_get(gengrid, widget);
+   if (gengrid->row_selected) return;
+
+   if (gengrid->horizontal)
+     {
+        rows = gengrid->per_line;
+        columns = eina_array_count(gengrid->items) / gengrid->per_line + 1;
+     }
+   else
+     {
+        rows = eina_array_count(gengrid->items) / gengrid->per_line + 1;
+        columns = gengrid->per_line;
+     }
+
+   gengrid->row_selected = g_array_sized_new(FALSE, TRUE, sizeof(guint), rows);
+   g_array_set_size(gengrid->row_selected, rows);
+   gengrid->column_selected =
+      g_array_sized_new(FALSE, TRUE, sizeof(guint), columns);
+   g_array_set_size(gengrid->column_selected, columns);
+
+   EINA_LIST_FOREACH(elm_gengrid_selected_items_get(widget), l, it)
+     _count_selected(gengrid, it, EINA_TRUE);
+}
+
+/**
+ * @brief Helper function to get number of items in a row or a column
+ *
+ * @param gengrid EailGengrid instance
+ * @param row TRUE for a row, FALSE for a column
+ * @param n number of row or column
+ *
+ * @returns number of items
+ */
+static gint
+_n_cells_get(EailGengrid *gengrid, gboolean row, gint n)
+{
+   gint count = eina_array_count(gengrid->items);
+   gint per_line = gengrid->per_line;
+
+   if (n < 0) return 0;
+
+   /* line runs along gengrid direction, the other one crosses lines */
+   if (row != gengrid->horizontal)
+     return CLAMP(count - n * per_line, 0, per_line);
+
+   if (n >= per_line) return 0;
+
+   return (count - n + per_line - 1) / per_line;
+}
+
+/**
+ * @brief Helper function to check if all items in a row or a column are
+ * selected
+ *
+ * Selected items counts have to be valid.
+ *
+ * @param gengrid EailGengrid instance
+ * @param row TRUE for a row, FALSE for a column
+ * @param n number of row or column
+ *
+ * @returns TRUE if there are items and all of them are selected
+ */
+static gboolean
+_is_line_selected(EailGengrid *gengrid, gboolean row, gint n)
+{
+   GArray *counts = row ? gengrid->row_selected : gengrid->column_selected;
+   gint n_cells = _n_cells_get(gengrid, row, n);
+
+   if (!n_cells || n >= counts->len) return FALSE;
+
+   return g_array_index(counts, guint, n) == n_cells;
+}
+
+/**
+ * @brief Callback used to keep selected items counts up to date
+ *
+ * @param gengrid EailGengrid instance
+ * @param it selected or unselected item
+ * @param selected EINA_TRUE if item was selected, EINA_FALSE otherwise
+ */
+static void
+_eail_gengrid_selection_update(EailGengrid *gengrid, Elm_Object_Item *it,
+                               Eina_Bool selected)
+{
+   Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(gengrid));
+
+   if (!widget || !it || !gengrid->row_selected) return;
+
+   eail_gengrid_items_validate(gengrid, widget);
+   eail_gengrid_per_line_get(gengrid, widget);
+   if (!gengrid->row_selected) return;
+
+   _count_selected(gengrid, it, selected);
+}
+
+/**
+ * @brief Callback used to count selected item in
+ *
+ * @param data EailGengrid instance
+ * @param obj elm_gengrid instance
+ * @param event_info selected item
+ */
+static void
+_eail_gengrid_on_item_selected(void *data, Evas_Object *obj, void *event_info)
+{
+   _eail_gengrid_selection_update(EAIL_GENGRID(data), event_info, EINA_TRUE);
+}
+
+/**
+ * @brief Callback used to count unselected item out
+ *
+ * @param data EailGengrid instance
+ * @param obj elm_gengrid instance
+ * @param event_info unselected item
+ */
+static void
+_eail_gengrid_on_item_unselected(void *data, Evas_Object *obj,
+                                 void *event_info)
+{
+   _eail_gengrid_selection_update(EAIL_GENGRID(data), event_info, EINA_FALSE);
+}
+
+/**
+ * @brief Callback used to learn how many items fit in one line from
+ * position of realized item
+ *
+ * @param data EailGengrid instance
+ * @param obj elm_gengrid instance
+ * @param event_info realized item
+ */
+static void
+_eail_gengrid_on_item_realized(void *data, Evas_Object *obj, void *event_info)
+{
+   EailGengrid *gengrid = EAIL_GENGRID(data);
+   Elm_Object_Item *it = event_info;
+   unsigned int x, y;
+
+   if (!it || !gengrid->per_line) return;
+
+   elm_gengrid_item_pos_get(it, &x, &y);
+   if ((gengrid->horizontal ? y : x) + 1 > gengrid->per_line)
+     {
+        eail_gengrid_selection_invalidate(gengrid);
+        gengrid->per_line = (gengrid->horizontal ? y : x) + 1;
+     }
+}
+
+/**
+ * @brief Callback used to drop items map when item is reordered
+ *
+ * @param data EailGengrid instance
+ * @param obj elm_gengrid instance
+ * @param event_info moved item
+ */
+static void
+_eail_gengrid_on_item_moved(void *data, Evas_Object *obj, void *event_info)
+{
+   eail_gengrid_items_invalidate(EAIL_GENGRID(data));
+}
+
+/**
+ * @brief Callback used to take line length again when gengrid is resized
+ *
+ * @param data EailGengrid instance
+ * @param e Evas instance
+ * @param obj elm_gengrid instance
+ * @param event_info event info
+ */
+static void
+_eail_gengrid_on_resize(void *data, Evas *e, Evas_Object *obj,
+                        void *event_info)
+{
+   EailGengrid *gengrid = EAIL_GENGRID(data);
+
+   eail_gengrid_selection_invalidate(gengrid);
+   gengrid->per_line = 0;
 }
 
 /**
@@ -70,12 +525,11 @@ eail_gengrid_items_get(EailGengrid *gengrid)
 static gint
 eail_gengrid_n_items_get(AtkObject *obj)
 {
-   gint n_items;
-   Eina_List *items = eail_gengrid_items_get(EAIL_GENGRID(obj));
-   n_items  = eina_list_count(items);
-   eina_list_free(items);
+   Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(obj));
+
+   if (!widget) return 0;
 
-   return n_items;
+   return elm_gengrid_items_count(widget);
 }
 
 /**
@@ -92,14 +546,12 @@ eail_gengrid_ref_child(AtkObject *obj, gint i)
    g_return_val_if_fail(EAIL_IS_GENGRID(obj), NULL);
 
    AtkObject *child = NULL;
+   Elm_Object_Item *it = eail_gengrid_item_nth(EAIL_GENGRID(obj), i);
 
-   Eina_List *list = eail_gengrid_items_get(EAIL_GENGRID(obj));
-   if (eina_list_count(list) > i)
+   if (it)
      {
-        child = eail_item_new(obj, ATK_ROLE_TABLE_CELL);
-        atk_object_initialize(child, eina_list_nth(list, i));
-
-        g_object_ref(child);
+        child = eail_item_parent_ref_item_accessible
+           (EAIL_ITEM_PARENT(obj), it, ATK_ROLE_TABLE_CELL);
      }
 
    return child;
@@ -136,8 +588,21 @@ eail_gengrid_ref_state_set(AtkObject *obj)
 static void
 eail_gengrid_initialize(AtkObject *obj, gpointer data)
 {
+   Evas_Object *widget = data;
+
    ATK_OBJECT_CLASS(eail_gengrid_parent_class)->initialize(obj, data);
    obj->role = ATK_ROLE_TABLE;
+
+   evas_object_smart_callback_add(widget, EAIL_GENGRID_REALIZED_NAME,
+                                  _eail_gengrid_on_item_realized, obj);
+   evas_object_smart_callback_add(widget, EAIL_GENGRID_MOVED_NAME,
+                                  _eail_gengrid_on_item_moved, obj);
+   evas_object_smart_callback_add(widget, EAIL_GENGRID_SELECTED_NAME,
+                                  _eail_gengrid_on_item_selected, obj);
+   evas_object_smart_callback_add(widget, EAIL_GENGRID_UNSELECTED_NAME,
+                                  _eail_gengrid_on_item_unselected, obj);
+   evas_object_event_callback_add(widget, EVAS_CALLBACK_RESIZE,
+                                  _eail_gengrid_on_resize, obj);
 }
 
 /**
@@ -148,6 +613,31 @@ eail_gengrid_initialize(AtkObject *obj, gpointer data)
 static void
 eail_gengrid_init(EailGengrid *gengrid)
 {
+   gengrid->items = eina_array_new(64);
+   gengrid->items_index = eina_hash_pointer_new(NULL);
+   gengrid->per_line = 0;
+   gengrid->horizontal = EINA_FALSE;
+   gengrid->selected = eina_hash_pointer_new(NULL);
+   gengrid->row_selected = NULL;
+   gengrid->column_selected = NULL;
+}
+
+/**
+ * @brief Finalize EailGengrid object
+ *
+ * @param object EailGengrid instance
+ */
+static void
+eail_gengrid_finalize(GObject *object)
+{
+   EailGengrid *gengrid = EAIL_GENGRID(object);
+
+   eail_gengrid_selection_invalidate(gengrid);
+   eina_hash_free(gengrid->selected);
+   eina_hash_free(gengrid->items_index);
+   eina_array_free(gengrid->items);
+
+   G_OBJECT_CLASS(eail_gengrid_parent_class)->finalize(object);
 }
 
 /**
@@ -159,11 +649,14 @@ static void
 eail_gengrid_class_init(EailGengridClass *klass)
 {
    AtkObjectClass *class = ATK_OBJECT_CLASS(klass);
+   GObjectClass *gobject_class = G_OBJECT_CLASS(klass);
 
    class->initialize = eail_gengrid_initialize;
    class->get_n_children = eail_gengrid_n_items_get;
    class->ref_child = eail_gengrid_ref_child;
    class->ref_state_set = eail_gengrid_ref_state_set;
+
+   gobject_class->finalize = eail_gengrid_finalize;
 }
 
 /**
@@ -193,11 +686,39 @@ eail_gengrid_item_name_get(EailItemParent *parent, EailItem *item)
 static int
 eail_gengrid_item_index_in_parent_get(EailItemParent *parent, EailItem *item)
 {
-   Elm_Object_Item *it = eail_item_get_item(item);
+   return eail_gengrid_item_index(EAIL_GENGRID(parent),
+                                  eail_item_get_item(item));
+}
 
-   if (!it) return -1;
+/**
+ * @brief Removes deleted item from items map, so it never keeps deleted item
+ *
+ * Only items following the deleted one are moved and reindexed.
+ *
+ * @param parent EailGengrid instance
+ * @param item deleted gengrid item
+ */
+static void
+eail_gengrid_item_deleted(EailItemParent *parent, Elm_Object_Item *item)
+{
+   EailGengrid *gengrid = EAIL_GENGRID(parent);
+   unsigned int n = eina_array_count(gengrid->items);
+   unsigned int index;
+   Elm_Object_Item *it;
+
+   index = GPOINTER_TO_UINT(eina_hash_find(gengrid->items_index, &item));
+   if (!index) return;
+
+   eail_gengrid_selection_invalidate(gengrid);
+   eina_hash_del_by_key(gengrid->items_index, &item);
 
-   return elm_gengrid_item_index_get(it);
+   for (; index < n; index++)
+     {
+        it = eina_array_data_get(gengrid->items, index);
+        eina_array_data_set(gengrid->items, index - 1, it);
+        eina_hash_modify(gengrid->items_index, &it, GUINT_TO_POINTER(index));
+     }
+   eina_array_pop(gengrid->items);
 }
 
 /**
@@ -314,41 +835,43 @@ eail_item_parent_interface_init(EailItemParentIface *iface)
    iface->ref_item_state_set       = eail_gengrid_ref_item_state_set;
    iface->grab_item_focus          = eail_gengrid_grab_item_focus;
    iface->get_item_extents         = eail_gengrid_item_extents_get;
+   iface->item_deleted             = eail_gengrid_item_deleted;
 }
 
 /**
  * @brief Helper function to get rows and columns count
  *
- * @param object elm_gengrid instance
+ * @param gengrid EailGengrid instance
  * @param rows address to store rows count
  * @param columns address to store columns count
  */
 static void
-_get_n_rows_columns(const Evas_Object *object,
-                    int *rows, int *columns)
+_get_n_rows_columns(EailGengrid *gengrid, int *rows, int *columns)
 {
-   Elm_Object_Item *it;
-   Eina_List *l, *list = elm_gengrid_realized_items_get(object);
-   int row, column;
+   Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(gengrid));
+   unsigned int count, per_line, lines;
+
+   *rows = 0;
+   *columns = 0;
+   if (!widget) return;
+
+   eail_gengrid_items_validate(gengrid, widget);
+   count = eina_array_count(gengrid->items);
+   if (!count) return;
+
+   per_line = eail_gengrid_per_line_get(gengrid, widget);
+   lines = (count + per_line - 1) / per_line;
 
-   if (list == NULL)
+   if (gengrid->horizontal)
      {
-        *rows = 0;
-        *columns = 0;
-        return;
+        *rows = MIN(count, per_line);
+        *columns = lines;
      }
-
-   row = column = 0;
-   EINA_LIST_FOREACH(list, l, it)
+   else
      {
-        unsigned int x, y;
-        elm_gengrid_item_pos_get(it, &x, &y);
-        if (x > row) row++;
-        if (y > column) column++;
+        *rows = lines;
+        *columns = MIN(count, per_line);
      }
-   eina_list_free(list);
-   *rows = row + 1;
-   *columns = column + 1;
 }
 
 
@@ -362,16 +885,11 @@ _get_n_rows_columns(const Evas_Object *object,
 static gint
 eail_gengrid_n_rows_get(AtkTable *table)
 {
-   Evas_Object *widget;
    int rows, columns;
 
    g_return_val_if_fail(EAIL_IS_GENGRID(table), -1);
 
-   widget = eail_widget_get_widget(EAIL_WIDGET(table));
-   if (!widget) return -1;
-
-   /*_get_last_coords(widget, &rows, &columns);*/
-   _get_n_rows_columns(widget, &rows, &columns);
+   _get_n_rows_columns(EAIL_GENGRID(table), &rows, &columns);
    return rows;
 }
 
@@ -385,16 +903,11 @@ eail_gengrid_n_rows_get(AtkTable *table)
 static gint
 eail_gengrid_n_columns_get(AtkTable *table)
 {
-   Evas_Object *widget;
    int rows, columns;
 
    g_return_val_if_fail(EAIL_IS_GENGRID(table), -1);
 
-   widget = eail_widget_get_widget(EAIL_WIDGET(table));
-
-   /*_get_last_coords(widget, &rows, &columns);*/
-   _get_n_rows_columns(widget, &rows, &columns);
-
+   _get_n_rows_columns(EAIL_GENGRID(table), &rows, &columns);
    return columns;
 }
 
@@ -410,21 +923,25 @@ eail_gengrid_n_columns_get(AtkTable *table)
 static gint
 eail_gengrid_index_at_get(AtkTable *table, gint row, gint column)
 {
-   Evas_Object *widget;
-   gint n_rows, n_columns;
+   EailGengrid *gengrid;
+   gint n_rows, n_columns, index;
 
    g_return_val_if_fail(EAIL_IS_GENGRID(table), -1);
-   widget = eail_widget_get_widget(EAIL_WIDGET(table));
-   if (!widget) return -1;
+   gengrid = EAIL_GENGRID(table);
 
-   _get_n_rows_columns(widget, &n_rows, &n_columns);
+   _get_n_rows_columns(gengrid, &n_rows, &n_columns);
 
-   if ((row >= n_rows) || (column >= n_columns)) return -1;
+   if ((row < 0) || (column < 0) || (row >= n_rows) || (column >= n_columns))
+     return -1;
 
-   if (elm_gengrid_horizontal_get(widget))
-     return ((n_columns) * column) + row;
+   if (gengrid->horizontal)
+     index = gengrid->per_line * column + row;
    else
-     return ((n_columns) * row) + column;
+     index = gengrid->per_line * row + column;
+
+   if (index >= eina_array_count(gengrid->items)) return -1;
+
+   return index;
 }
 
 /**
@@ -449,34 +966,6 @@ eail_gengrid_ref_at(AtkTable *table, gint row, gint column)
    return eail_gengrid_ref_child(ATK_OBJECT(table), index);
 }
 
-/**
- * @brief Helper function to get object position in table at given index
- *
- * @param widget elm_gengrid widget
- * @param row address to store row number
- * @param column address to store column number
- * @param index index of child item
- */
-static void
-_get_item_pos(const Evas_Object *widget, gint *row, gint *column, gint index)
-{
-   Elm_Object_Item *it;
-   Eina_List *list;
-
-   if (!widget)
-     {
-        *row = -1;
-        *column = -1;
-        return;
-     }
-
-   list = elm_gengrid_realized_items_get(widget);
-   it = eina_list_nth(list, index);
-   elm_gengrid_item_pos_get(it, (unsigned int *)row, (unsigned int *) column);
-
-   eina_list_free(list);
-}
-
 /**
  * @brief Implementation of get_column_at_index from AtkTable
  *
@@ -488,12 +977,10 @@ _get_item_pos(const Evas_Object *widget, gint *row, gint *column, gint index)
 static gint
 eail_gengrid_column_at_index_get(AtkTable *table, gint index)
 {
-   Evas_Object *widget;
    int row, column;
 
    g_return_val_if_fail(EAIL_IS_GENGRID(table), -1);
-   widget = eail_widget_get_widget(EAIL_WIDGET(table));
-   _get_item_pos(widget, &row, &column, index);
+   eail_gengrid_item_pos_get(EAIL_GENGRID(table), index, &row, &column);
 
    return column;
 }
@@ -509,12 +996,10 @@ eail_gengrid_column_at_index_get(AtkTable *table, gint index)
 static gint
 eail_gengrid_row_at_index_get(AtkTable *table, gint index)
 {
-   Evas_Object *widget;
    int row, column;
 
    g_return_val_if_fail(EAIL_IS_GENGRID(table), -1);
-   widget = eail_widget_get_widget(EAIL_WIDGET(table));
-   _get_item_pos(widget, &row, &column, index);
+   eail_gengrid_item_pos_get(EAIL_GENGRID(table), index, &row, &column);
 
    return row;
 }
@@ -531,23 +1016,16 @@ eail_gengrid_row_at_index_get(AtkTable *table, gint index)
 static gboolean
 eail_gengrid_is_selected(AtkTable *table, gint row, gint column)
 {
-   Evas_Object *widget;
    Elm_Object_Item *it;
    int index;
-   Eina_List *list;
-   gboolean result;
 
    g_return_val_if_fail(EAIL_IS_GENGRID(table), FALSE);
-   widget = eail_widget_get_widget(EAIL_WIDGET(table));
    index = eail_gengrid_index_at_get(table, row, column);
    if (index == -1) return FALSE;
 
-   list = elm_gengrid_realized_items_get(widget);
-   it = eina_list_nth(list, index);
-   result = elm_gengrid_item_selected_get(it);
+   it = eail_gengrid_item_nth(EAIL_GENGRID(table), index);
 
-   eina_list_free(list);
-   return result;
+   return (elm_gengrid_item_selected_get(it) ? TRUE : FALSE);
 }
 
 /**
@@ -562,41 +1040,17 @@ static gboolean
 eail_gengrid_is_row_selected(AtkTable *table, gint row)
 {
    Evas_Object *widget;
-   Eina_List *list;
-   const Eina_List *selected;
-   gboolean result;
-   int list_count, n_rows;
 
    g_return_val_if_fail(EAIL_IS_GENGRID(table), FALSE);
    widget = eail_widget_get_widget(EAIL_WIDGET(table));
    /*it is possible to select row only in multiselct mode*/
-   if (!elm_gengrid_multi_select_get(widget))
+   if (!widget || !elm_gengrid_multi_select_get(widget))
      return FALSE;
 
-   selected = elm_gengrid_selected_items_get(widget);
-   if (!selected) return FALSE;
-
-   n_rows = eail_gengrid_n_rows_get(table);
-   if (row > n_rows) return FALSE;
+   eail_gengrid_selection_validate(EAIL_GENGRID(table), widget);
 
-   list = elm_gengrid_realized_items_get(widget);
-   list_count = eina_list_count(list);
-
-   result = TRUE;
-   for (int i = 0; i < list_count; i++)
-     {
-        Elm_Object_Item *it = eina_list_nth(list, i);
-        unsigned int x, y;
-        elm_gengrid_item_pos_get(it, &x, &y);
-        if((row == x) && (!elm_gengrid_item_selected_get(it)))
-          {
-             /*row is considered selected if all items in row are selected*/
-             result = FALSE;
-             break;
-          }
-     }
-   eina_list_free(list);
-   return result;
+   /*row is considered selected if all items in row are selected*/
+   return _is_line_selected(EAIL_GENGRID(table), TRUE, row);
 }
 
 /**
@@ -620,11 +1074,12 @@ eail_gengrid_selected_rows_get(AtkTable *table, gint **selected)
    if (!widget) return 0;
    if (!elm_gengrid_multi_select_get(widget)) return 0;
 
+   eail_gengrid_selection_validate(EAIL_GENGRID(table), widget);
    n_rows = eail_gengrid_n_rows_get(table);
    array = g_array_new(FALSE, FALSE, sizeof(gint));
    for (int i = 0; i < n_rows; i++)
      {
-        gboolean success = eail_gengrid_is_row_selected(table, i);
+        gboolean success = _is_line_selected(EAIL_GENGRID(table), TRUE, i);
         if (success) g_array_append_val(array, i);
      }
    n_selected = array->len;
@@ -642,22 +1097,16 @@ eail_gengrid_selected_rows_get(AtkTable *table, gint **selected)
 static void
 _set_row_selection(AtkTable *table, int row, Eina_Bool selection)
 {
-   Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(table));
-   Eina_List *list = elm_gengrid_realized_items_get(widget);
-   int list_count = eina_list_count(list);
+   int n_columns = eail_gengrid_n_columns_get(table);
 
-   for (int i = 0; i < list_count; i++)
+   for (int i = 0; i < n_columns; i++)
      {
-        unsigned int x, y;
-        Elm_Object_Item *it = eina_list_nth(list, i);
-        elm_gengrid_item_pos_get(it, &x, &y);
-        if (x == row)
-          {
-             elm_gengrid_item_selected_set(it, selection);
-          }
-     }
+        gint index = eail_gengrid_index_at_get(table, row, i);
+        if (index == -1) continue;
 
-   eina_list_free(list);
+        elm_gengrid_item_selected_set
+           (eail_gengrid_item_nth(EAIL_GENGRID(table), index), selection);
+     }
 }
 
 /**
@@ -680,7 +1129,7 @@ eail_gengrid_add_row_selection(AtkTable *table, gint row)
    if (!widget) return FALSE;
    if (!elm_gengrid_multi_select_get(widget)) return FALSE;
    n_rows = eail_gengrid_n_rows_get(table);
-   if (row > n_rows) return FALSE;
+   if ((row < 0) || (row >= n_rows)) return FALSE;
 
    _set_row_selection(table, row, EINA_TRUE);
    return TRUE;
@@ -706,7 +1155,7 @@ eail_gengrid_remove_row_selection(AtkTable *table, gint row)
    if (!widget) return FALSE;
    if (!elm_gengrid_multi_select_get(widget)) return FALSE;
    n_rows = eail_gengrid_n_rows_get(table);
-   if (row > n_rows) return FALSE;
+   if ((row < 0) || (row >= n_rows)) return FALSE;
 
    _set_row_selection(table, row, EINA_FALSE);
    return TRUE;
@@ -725,36 +1174,48 @@ static gboolean
 eail_gengrid_is_column_selected(AtkTable *table, gint column)
 {
    Evas_Object *widget;
-   Eina_List *list;
-   const Eina_List *selected;
-   int n_columns, list_count;
-   gboolean result;
 
    g_return_val_if_fail(EAIL_IS_GENGRID(table), FALSE);
    widget = eail_widget_get_widget(EAIL_WIDGET(table));
-   if (!elm_gengrid_multi_select_get(widget)) return FALSE;
-   n_columns = eail_gengrid_n_columns_get(table);
-   if (column > n_columns) return FALSE;
-   selected = elm_gengrid_selected_items_get(widget);
-   if (!selected) return FALSE;
+   if (!widget || !elm_gengrid_multi_select_get(widget)) return FALSE;
 
-   list = elm_gengrid_realized_items_get(widget);
-   list_count = eina_list_count(list);
-   result = TRUE;
-   for (int i = 0; i < list_count; i++)
+   eail_gengrid_selection_validate(EAIL_GENGRID(table), widget);
+
+   return _is_line_selected(EAIL_GENGRID(table), FALSE, column);
+}
+
+/**
+ * @brief Implementation of get_selected_columns from AtkTable interface
+ *
+ * @param table EailGengrid instace
+ * @param selected address to gint* for store selected columns number
+ *
+ * @returns selected columns count
+ */
+static gint
+eail_gengrid_selected_columns_get(AtkTable *table, gint **selected)
+{
+   GArray *array;
+   Evas_Object *widget;
+   int n_columns, n_selected;
+
+   g_return_val_if_fail(EAIL_IS_GENGRID(table), 0);
+   widget = eail_widget_get_widget(EAIL_WIDGET(table));
+
+   if (!widget) return 0;
+   if (!elm_gengrid_multi_select_get(widget)) return 0;
+
+   eail_gengrid_selection_validate(EAIL_GENGRID(table), widget);
+   n_columns = eail_gengrid_n_columns_get(table);
+   array = g_array_new(FALSE, FALSE, sizeof(gint));
+   for (int i = 0; i < n_columns; i++)
      {
-        Elm_Object_Item *it = eina_list_nth(list, i);
-        unsigned int x, y;
-        elm_gengrid_item_pos_get(it, &x, &y);
-        if ((y == column) && (!elm_gengrid_item_selected_get(it)))
-          {
-             result = FALSE;
-             break;
-          }
+        gboolean success = _is_line_selected(EAIL_GENGRID(table), FALSE, i);
+        if (success) g_array_append_val(array, i);
      }
-
-   eina_list_free(list);
-   return result;
+   n_selected = array->len;
+   *selected = (gint *) g_array_free(array, FALSE);
+   return n_selected;
 }
 
 /**
@@ -767,22 +1228,16 @@ eail_gengrid_is_column_selected(AtkTable *table, gint column)
 static void
 _set_column_selection(AtkTable *table, int column, Eina_Bool selection)
 {
-   Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(table));
-   Eina_List *list = elm_gengrid_realized_items_get(widget);
-   int list_count = eina_list_count(list);
+   int n_rows = eail_gengrid_n_rows_get(table);
 
-   for (int i = 0; i < list_count; i++)
+   for (int i = 0; i < n_rows; i++)
      {
-        unsigned int x, y;
-        Elm_Object_Item *it = eina_list_nth(list, i);
-        elm_gengrid_item_pos_get(it, &x, &y);
-        if (y == column)
-          {
-             elm_gengrid_item_selected_set(it, selection);
-          }
-     }
+        gint index = eail_gengrid_index_at_get(table, i, column);
+        if (index == -1) continue;
 
-   eina_list_free(list);
+        elm_gengrid_item_selected_set
+           (eail_gengrid_item_nth(EAIL_GENGRID(table), index), selection);
+     }
 }
 
 /**
@@ -804,7 +1259,7 @@ eail_gengrid_add_column_selection(AtkTable *table, gint column)
    if (!widget) return FALSE;
    if (!elm_gengrid_multi_select_get(widget)) return FALSE;
    n_columns = eail_gengrid_n_columns_get(table);
-   if (column > n_columns) return FALSE;
+   if ((column < 0) || (column >= n_columns)) return FALSE;
 
    _set_column_selection(table, column, EINA_TRUE);
    return TRUE;
@@ -829,13 +1284,29 @@ eail_gengrid_remove_column_selection(AtkTable *table, gint column)
    if (!widget) return FALSE;
    if (!elm_gengrid_multi_select_get(widget)) return FALSE;
    n_columns = eail_gengrid_n_columns_get(table);
-   if (column > n_columns) return FALSE;
+   if ((column < 0) || (column >= n_columns)) return FALSE;
 
    _set_column_selection(table, column, EINA_FALSE);
    return TRUE;
 
 }
 
+/**
+ * @brief Implementation of get_row_extent_at and get_column_extent_at from
+ * AtkTable interface
+ *
+ * @param table EailGengrid instance
+ * @param row row number in table
+ * @param column column number in table
+ *
+ * @returns 1 if there is item at given position, 0 otherwise
+ */
+static gint
+eail_gengrid_extent_at_get(AtkTable *table, gint row, gint column)
+{
+   return (eail_gengrid_index_at_get(table, row, column) == -1) ? 0 : 1;
+}
+
 /**
  * @brief AtkTable interface initialization
  *
@@ -855,15 +1326,17 @@ atk_table_interface_init(AtkTableIface *iface)
    iface->is_row_selected = eail_gengrid_is_row_selected;
    iface->is_selected = eail_gengrid_is_selected;
    iface->get_selected_rows = eail_gengrid_selected_rows_get;
+   iface->get_selected_columns = eail_gengrid_selected_columns_get;
    iface->add_row_selection = eail_gengrid_add_row_selection;
    iface->remove_row_selection = eail_gengrid_remove_row_selection;
    iface->is_column_selected = eail_gengrid_is_column_selected;
    iface->add_column_selection = eail_gengrid_add_column_selection;
    iface->remove_column_selection = eail_gengrid_remove_column_selection;
 
+   iface->get_column_extent_at = eail_gengrid_extent_at_get;
+   iface->get_row_extent_at = eail_gengrid_extent_at_get;
+
    /*unsupported*/
-   iface->get_column_extent_at = NULL;
-   iface->get_row_extent_at = NULL;
    iface->get_column_header = NULL;
    iface->get_column_description = NULL;
 }
@@ -879,28 +1352,15 @@ atk_table_interface_init(AtkTableIface *iface)
 static gboolean
 eail_gengrid_selection_add(AtkSelection *selection, gint i)
 {
-   Evas_Object *widget;
    Elm_Object_Item *it;
-   Eina_List *list;
-   gboolean result;
 
    g_return_val_if_fail(EAIL_IS_GENGRID(selection), FALSE);
-   widget = eail_widget_get_widget(EAIL_WIDGET(selection));
-   list = elm_gengrid_realized_items_get(widget);
-
-   if (i > eina_list_count(list)) return FALSE;
-   it = eina_list_nth(list, i);
+   it = eail_gengrid_item_nth(EAIL_GENGRID(selection), i);
 
-   if (elm_gengrid_item_selected_get(it))
-     result = FALSE;
-   else
-     {
-        elm_gengrid_item_selected_set(it, EINA_TRUE);
-        result = TRUE;
-     }
+   if (!it || elm_gengrid_item_selected_get(it)) return FALSE;
 
-   eina_list_free(list);
-   return result;
+   elm_gengrid_item_selected_set(it, EINA_TRUE);
+   return TRUE;
 }
 
 /**
@@ -974,10 +1434,8 @@ eail_gengrid_selection_ref(AtkSelection *selection, gint i)
 
    if (!it) return NULL;
 
-   child = eail_item_new(ATK_OBJECT(selection), ATK_ROLE_TABLE_CELL);
-   atk_object_initialize(child, it);
-
-   g_object_ref(child);
+   child = eail_item_parent_ref_item_accessible
+      (EAIL_ITEM_PARENT(selection), it, ATK_ROLE_TABLE_CELL);
 
    return child;
 }
@@ -1024,26 +1482,12 @@ eail_gengrid_selection_count_get(AtkSelection *selection)
 static gboolean
 eail_gengrid_selection_is_child_selected(AtkSelection *selection, int i)
 {
-   Evas_Object *widget;
    Elm_Object_Item *it;
-   Eina_List *list;
-   gboolean selected;
 
    g_return_val_if_fail(EAIL_IS_GENGRID(selection), FALSE);
-   widget = eail_widget_get_widget(EAIL_WIDGET(selection));
-   list = elm_gengrid_realized_items_get(widget);
+   it = eail_gengrid_item_nth(EAIL_GENGRID(selection), i);
 
-   if (i > eina_list_count(list))
-     {
-        eina_list_free(list);
-        return FALSE;
-     }
-
-   it = eina_list_nth(list, i);
-   selected = (elm_gengrid_item_selected_get(it) ? TRUE : FALSE);
-   eina_list_free(list);
-
-   return selected;
+   return (elm_gengrid_item_selected_get(it) ? TRUE : FALSE);
 }
 
 /**
@@ -1094,18 +1538,22 @@ eail_gengrid_selection_remove(AtkSelection *selection, gint i)
 static gboolean
 eail_gengrid_selection_select_all(AtkSelection *selection)
 {
+   EailGengrid *gengrid;
    Evas_Object *widget;
    Elm_Object_Item *it;
-   Eina_List *l, *list;
+   Eina_Array_Iterator iterator;
+   unsigned int i;
 
    g_return_val_if_fail(EAIL_IS_GENGRID(selection), FALSE);
+   gengrid = EAIL_GENGRID(selection);
    widget = eail_widget_get_widget(EAIL_WIDGET(selection));
-   if (!elm_gengrid_multi_select_get(widget)) return FALSE;
+   if (!widget || !elm_gengrid_multi_select_get(widget)) return FALSE;
 
-   list = elm_gengrid_realized_items_get(widget);
-   EINA_LIST_FOREACH(list, l, it)
+   eail_gengrid_items_validate(gengrid, widget);
+   EINA_ARRAY_ITER_NEXT(gengrid->items, i, it, iterator)
      {
-        elm_gengrid_item_selected_set(it, EINA_TRUE);
+        if (!elm_gengrid_item_selected_get(it))
+          elm_gengrid_item_selected_set(it, EINA_TRUE);
      }
    return TRUE;
 }
@@ -48,6 +48,17 @@ typedef struct _EailGengridClass EailGengridClass;
 struct _EailGengrid
 {
    EailWidget parent; /*!< EailGengrid parent*/
+
+   Eina_Array *items; /*!< all items of gengrid in child order*/
+   Eina_Hash *items_index; /*!< Elm_Object_Item* to its index + 1*/
+   unsigned int per_line; /*!< items in one row (one column in horizontal
+                            mode), 0 if not known yet*/
+   Eina_Bool horizontal; /*!< gengrid mode per_line was taken in*/
+   Eina_Hash *selected; /*!< selected items counted in row_selected and
+                          column_selected*/
+   GArray *row_selected; /*!< number of selected items in each row, NULL if
+                           not counted yet*/
+   GArray *column_selected; /*!< number of selected items in each column*/
 };
 
 struct _EailGengridClass
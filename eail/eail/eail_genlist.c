@@ -24,67 +24,394 @@
 
 #include <Eina.h>
 #include <Evas.h>
+#include <Ecore.h>
+#include <Ecore_Evas.h>
 #include <Elementary.h>
 
 #include "eail_genlist.h"
 #include "eail_item_parent.h"
 #include "eail_item.h"
+#include "eail_utils.h"
 #include "eail_priv.h"
 
 static void eail_item_parent_interface_init   (EailItemParentIface *iface);
 static void atk_selection_interface_init(AtkSelectionIface *iface);
+static void atk_table_interface_init(AtkTableIface *iface);
 
 /**
  * @brief definition of EailGenlist as GObject
  *
- * EailList is extended ScrollableWidget with EAIL_TYPE_ITEM_PARENT and
- * ATK_TYPE_SELECTION implemented
+ * EailList is extended ScrollableWidget with EAIL_TYPE_ITEM_PARENT,
+ * ATK_TYPE_SELECTION and ATK_TYPE_TABLE implemented
  */
 G_DEFINE_TYPE_WITH_CODE(EailGenlist, eail_genlist, EAIL_TYPE_SCROLLABLE_WIDGET,
                         G_IMPLEMENT_INTERFACE(EAIL_TYPE_ITEM_PARENT,
                                               eail_item_parent_interface_init)
                         G_IMPLEMENT_INTERFACE(ATK_TYPE_SELECTION,
                                                  atk_selection_interface_init)
+                        G_IMPLEMENT_INTERFACE(ATK_TYPE_TABLE,
+                                              atk_table_interface_init)
 )
 
 #define EAIL_GENLIST_TEXT "elm.text"
 
+#define EAIL_GENLIST_REALIZED_NAME "realized"
+#define EAIL_GENLIST_UNREALIZED_NAME "unrealized"
+#define EAIL_GENLIST_EXPANDED_NAME "expanded"
+#define EAIL_GENLIST_CONTRACTED_NAME "contracted"
+#define EAIL_GENLIST_SELECTED_NAME "selected"
+#define EAIL_GENLIST_UNSELECTED_NAME "unselected"
+#define EAIL_GENLIST_SCROLL_NAME "scroll"
+
 /*
  * Implementation of the *AtkObject* interface
  */
 
 /**
- * @brief Initializer for AtkObjectClass
+ * @brief Drops index of selected items
+ *
+ * Index will be built again on next request
+ *
+ * @param genlist an EailGenlist
  */
 static void
-eail_genlist_initialize(AtkObject *obj, gpointer data)
+eail_genlist_selection_invalidate(EailGenlist *genlist)
 {
-    ATK_OBJECT_CLASS(eail_genlist_parent_class)->initialize(obj, data);
+    if (genlist->selected) {
+        eina_array_free(genlist->selected);
+        genlist->selected = NULL;
+    }
+}
 
-    obj->role = ATK_ROLE_LIST;
+/**
+ * @brief Drops cached rectangles of realized items
+ *
+ * @param genlist an EailGenlist
+ */
+static void
+eail_genlist_item_rects_invalidate(EailGenlist *genlist)
+{
+    eina_hash_free_buckets(genlist->item_rects);
+    genlist->item_rects_time = -1.0;
 }
 
 /**
- * @brief Prepares Eina_List filled with Elm_Object_Item* objects
- * representing items in the list
+ * @brief Drops index to item map
+ *
+ * Map will be filled again on next request
  *
- * @return filled list with list items. Call eina_list_free on that list when
- * results processing has been finished
+ * @param genlist an EailGenlist
  */
-static Eina_List *
-eail_genlist_get_items(EailGenlist *genlist)
+static void
+eail_genlist_items_invalidate(EailGenlist *genlist)
+{
+    eail_genlist_selection_invalidate(genlist);
+    eail_genlist_item_rects_invalidate(genlist);
+    eina_array_clean(genlist->items);
+    eina_hash_free_buckets(genlist->items_index);
+    genlist->items_count = 0;
+}
+
+/**
+ * @brief Checks if index to item map is still valid and drops it otherwise
+ *
+ * Adding items changes item count of genlist, which is cheap to check on
+ * every request. Deleting mapped items drops the map right away, see
+ * eail_genlist_item_deleted.
+ *
+ * @param genlist an EailGenlist
+ * @param widget genlist Evas_Object
+ */
+static void
+eail_genlist_items_validate(EailGenlist *genlist, Evas_Object *widget)
+{
+    unsigned int count = elm_genlist_items_count(widget);
+
+    if (genlist->items_count != count) {
+        eail_genlist_items_invalidate(genlist);
+        genlist->items_count = count;
+    }
+}
+
+/**
+ * @brief Appends next item to index to item map
+ *
+ * Appended item is watched, so the map is dropped when it is deleted.
+ *
+ * @param genlist an EailGenlist
+ * @param widget genlist Evas_Object
+ * @return appended item or NULL if all items are already in the map
+ */
+static Elm_Object_Item *
+eail_genlist_items_fill_next(EailGenlist *genlist, Evas_Object *widget)
 {
-    Eina_List *items = NULL;
     Elm_Object_Item *item;
+    unsigned int n = eina_array_count(genlist->items);
+
+    if (!n) {
+        item = elm_genlist_first_item_get(widget);
+    } else {
+        item = elm_genlist_item_next_get(eina_array_data_get(genlist->items,
+                                                             n - 1));
+    }
+
+    if (!item) {
+        return NULL;
+    }
+
+    eina_array_push(genlist->items, item);
+    eina_hash_add(genlist->items_index, &item, GINT_TO_POINTER(n + 1));
+    eail_item_parent_watch_item(item);
+
+    return item;
+}
+
+/**
+ * @brief Gets item with given index
+ *
+ * Items are walked only up to requested index and remembered, so subsequent
+ * requests for already visited indexes are O(1)
+ *
+ * @param genlist an EailGenlist
+ * @param i index of item
+ * @return item or NULL if there is no item with given index
+ */
+static Elm_Object_Item *
+eail_genlist_item_nth(EailGenlist *genlist, gint i)
+{
+    Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(genlist));
+
+    if (!widget || i < 0) {
+        return NULL;
+    }
+
+    eail_genlist_items_validate(genlist, widget);
+
+    while (eina_array_count(genlist->items) <= i) {
+        if (!eail_genlist_items_fill_next(genlist, widget)) {
+            return NULL;
+        }
+    }
+
+    return eina_array_data_get(genlist->items, i);
+}
+
+/**
+ * @brief Gets index of given item
+ *
+ * @param genlist an EailGenlist
+ * @param item an Elm_Object_Item
+ * @return item index or -1 if item was not found
+ */
+static gint
+eail_genlist_item_index(EailGenlist *genlist, Elm_Object_Item *item)
+{
+    Elm_Object_Item *next;
     Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(genlist));
+    gpointer index;
+
+    if (!widget) {
+        return -1;
+    }
+
+    eail_genlist_items_validate(genlist, widget);
+
+    index = eina_hash_find(genlist->items_index, &item);
+    if (index) {
+        return GPOINTER_TO_INT(index) - 1;
+    }
+
+    while ((next = eail_genlist_items_fill_next(genlist, widget))) {
+        if (next == item) {
+            return eina_array_count(genlist->items) - 1;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Gets accessible for given item
+ *
+ * Accessibles are pooled by EailItemParent, so the same item is always
+ * represented by the same EailItem
+ *
+ * @param genlist an EailGenlist
+ * @param item an Elm_Object_Item
+ * @return EailItem for item, owned by the caller
+ */
+static AtkObject *
+eail_genlist_ref_item_accessible(EailGenlist *genlist, Elm_Object_Item *item)
+{
+    return eail_item_parent_ref_item_accessible(EAIL_ITEM_PARENT(genlist),
+                                                item, ATK_ROLE_LIST_ITEM);
+}
+
+/**
+ * @brief Callback used to keep index to item map in sync with newly
+ * realized items
+ *
+ * Item realized for the first time that lands inside already mapped range
+ * has been inserted there, so the map is dropped.
+ *
+ * @param data an EailGenlist
+ * @param obj genlist Evas_Object
+ * @param event_info realized Elm_Object_Item
+ */
+static void
+eail_genlist_on_item_realized(void *data, Evas_Object *obj, void *event_info)
+{
+    EailGenlist *genlist = EAIL_GENLIST(data);
+    Elm_Object_Item *item = event_info;
+    Elm_Object_Item *prev;
+    unsigned int n = eina_array_count(genlist->items);
+
+    eail_genlist_item_rects_invalidate(genlist);
+
+    if (!item || !n || eina_hash_find(genlist->items_index, &item)) {
+        return;
+    }
+
+    prev = elm_genlist_item_prev_get(item);
+    if (prev == eina_array_data_get(genlist->items, n - 1)) {
+        return;
+    }
+
+    if (!prev || eina_hash_find(genlist->items_index, &prev)) {
+        eail_genlist_items_invalidate(genlist);
+    }
+}
+
+/**
+ * @brief Callback used to keep index to item map in sync with unrealized
+ * items
+ *
+ * Item that is unrealized but is not the one stored under its index has been
+ * moved or deleted, so the map is dropped
+ *
+ * @param data an EailGenlist
+ * @param obj genlist Evas_Object
+ * @param event_info unrealized Elm_Object_Item
+ */
+static void
+eail_genlist_on_item_unrealized(void *data, Evas_Object *obj, void *event_info)
+{
+    EailGenlist *genlist = EAIL_GENLIST(data);
+    Elm_Object_Item *item = event_info;
+    Elm_Object_Item *next;
+    gpointer index;
+
+    eail_genlist_item_rects_invalidate(genlist);
+
+    if (!item) {
+        return;
+    }
+
+    index = eina_hash_find(genlist->items_index, &item);
+    if (!index) {
+        return;
+    }
+
+    next = elm_genlist_item_next_get(item);
+    if (GPOINTER_TO_UINT(index) < eina_array_count(genlist->items) &&
+        next != eina_array_data_get(genlist->items, GPOINTER_TO_UINT(index))) {
+        eail_genlist_items_invalidate(genlist);
+    }
+}
+
+/**
+ * @brief Callback used to drop index to item map when subitems of tree item
+ * are shown or hidden
+ *
+ * @param data an EailGenlist
+ * @param obj genlist Evas_Object
+ * @param event_info expanded or contracted Elm_Object_Item
+ */
+static void
+eail_genlist_on_tree_changed(void *data, Evas_Object *obj, void *event_info)
+{
+    eail_genlist_items_invalidate(EAIL_GENLIST(data));
+}
+
+/**
+ * @brief Callback used to drop index of selected items when selection changes
+ *
+ * @param data an EailGenlist
+ * @param obj genlist Evas_Object
+ * @param event_info selected or unselected Elm_Object_Item
+ */
+static void
+eail_genlist_on_selection_changed(void *data, Evas_Object *obj,
+                                  void *event_info)
+{
+    eail_genlist_selection_invalidate(EAIL_GENLIST(data));
+}
+
+/**
+ * @brief Callback used to drop cached item rectangles when items move on
+ * screen
+ *
+ * @param data an EailGenlist
+ * @param obj genlist Evas_Object
+ * @param event_info additional event info (not used here)
+ */
+static void
+eail_genlist_on_scroll(void *data, Evas_Object *obj, void *event_info)
+{
+    eail_genlist_item_rects_invalidate(EAIL_GENLIST(data));
+}
+
+/**
+ * @brief Callback used to drop cached item rectangles when genlist is moved
+ * or resized
+ *
+ * @param data an EailGenlist
+ * @param e an Evas
+ * @param obj genlist Evas_Object
+ * @param event_info additional event info (not used here)
+ */
+static void
+eail_genlist_on_geometry_changed(void *data, Evas *e, Evas_Object *obj,
+                                 void *event_info)
+{
+    eail_genlist_item_rects_invalidate(EAIL_GENLIST(data));
+}
+
+/**
+ * @brief Initializer for AtkObjectClass
+ */
+static void
+eail_genlist_initialize(AtkObject *obj, gpointer data)
+{
+    Evas_Object *widget;
+
+    ATK_OBJECT_CLASS(eail_genlist_parent_class)->initialize(obj, data);
+
+    obj->role = ATK_ROLE_LIST;
 
-    item = elm_genlist_first_item_get(widget);
-    while (item) {
-        items = eina_list_append(items, item);
-        item = elm_genlist_item_next_get(item);
+    widget = eail_widget_get_widget(EAIL_WIDGET(obj));
+    if (!widget) {
+        return;
     }
 
-    return items;
+    evas_object_smart_callback_add(widget, EAIL_GENLIST_REALIZED_NAME,
+                                   eail_genlist_on_item_realized, obj);
+    evas_object_smart_callback_add(widget, EAIL_GENLIST_UNREALIZED_NAME,
+                                   eail_genlist_on_item_unrealized, obj);
+    evas_object_smart_callback_add(widget, EAIL_GENLIST_EXPANDED_NAME,
+                                   eail_genlist_on_tree_changed, obj);
+    evas_object_smart_callback_add(widget, EAIL_GENLIST_CONTRACTED_NAME,
+                                   eail_genlist_on_tree_changed, obj);
+    evas_object_smart_callback_add(widget, EAIL_GENLIST_SELECTED_NAME,
+                                   eail_genlist_on_selection_changed, obj);
+    evas_object_smart_callback_add(widget, EAIL_GENLIST_UNSELECTED_NAME,
+                                   eail_genlist_on_selection_changed, obj);
+    evas_object_smart_callback_add(widget, EAIL_GENLIST_SCROLL_NAME,
+                                   eail_genlist_on_scroll, obj);
+    evas_object_event_callback_add(widget, EVAS_CALLBACK_MOVE,
+                                   eail_genlist_on_geometry_changed, obj);
+    evas_object_event_callback_add(widget, EVAS_CALLBACK_RESIZE,
+                                   eail_genlist_on_geometry_changed, obj);
 }
 
 /**
@@ -99,15 +426,13 @@ eail_genlist_get_items(EailGenlist *genlist)
 static gint
 eail_genlist_get_n_children(AtkObject *obj)
 {
-    gint n_items;
-    Eina_List *items;
-
-    items = eail_genlist_get_items(EAIL_GENLIST(obj));
-    n_items = eina_list_count(items);
+    Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(obj));
 
-    eina_list_free(items);
+    if (!widget) {
+        return 0;
+    }
 
-    return n_items;
+    return elm_genlist_items_count(widget);
 }
 
 /**
@@ -124,20 +449,15 @@ eail_genlist_get_n_children(AtkObject *obj)
 static AtkObject *
 eail_genlist_ref_child(AtkObject *obj, gint i)
 {
-    Eina_List *items;
-    AtkObject *child = NULL;
-
-    items = eail_genlist_get_items(EAIL_GENLIST(obj));
-    if (eina_list_count(items) > i) {
-        child = eail_item_new(obj, ATK_ROLE_LIST_ITEM);
-        atk_object_initialize(child, eina_list_nth(items, i));
+    EailGenlist *genlist = EAIL_GENLIST(obj);
+    Elm_Object_Item *item;
 
-        g_object_ref(child);
+    item = eail_genlist_item_nth(genlist, i);
+    if (!item) {
+        return NULL;
     }
 
-    eina_list_free(items);
-
-    return child;
+    return eail_genlist_ref_item_accessible(genlist, item);
 }
 
 /**
@@ -175,6 +495,32 @@ eail_genlist_ref_state_set(AtkObject *obj)
 static void
 eail_genlist_init(EailGenlist *genlist)
 {
+    genlist->items = eina_array_new(32);
+    genlist->items_index = eina_hash_pointer_new(NULL);
+    genlist->items_count = 0;
+    genlist->selected = NULL;
+    genlist->item_rects = eina_hash_pointer_new(free);
+    genlist->item_rects_time = -1.0;
+    genlist->item_rects_first = -1;
+    genlist->item_rects_last = -1;
+    genlist->item_rects_height = 0;
+    genlist->focused_item = NULL;
+}
+
+/**
+ * @brief Finalize function for GObject
+ */
+static void
+eail_genlist_finalize(GObject *object)
+{
+    EailGenlist *genlist = EAIL_GENLIST(object);
+
+    eail_genlist_selection_invalidate(genlist);
+    eina_hash_free(genlist->item_rects);
+    eina_hash_free(genlist->items_index);
+    eina_array_free(genlist->items);
+
+    G_OBJECT_CLASS(eail_genlist_parent_class)->finalize(object);
 }
 
 /**
@@ -184,6 +530,9 @@ static void
 eail_genlist_class_init(EailGenlistClass *klass)
 {
     AtkObjectClass *class = ATK_OBJECT_CLASS(klass);
+    GObjectClass *gobject_class = G_OBJECT_CLASS(klass);
+
+    gobject_class->finalize = eail_genlist_finalize;
 
     class->initialize = eail_genlist_initialize;
     class->get_n_children = eail_genlist_get_n_children;
@@ -233,7 +582,7 @@ eail_genlist_get_item_index_in_parent(EailItemParent    *parent,
         return -1;
     }
 
-    return elm_genlist_item_index_get(it);
+    return eail_genlist_item_index(EAIL_GENLIST(parent), it);
 }
 
 /**
@@ -279,6 +628,15 @@ eail_genlist_ref_item_state_set(EailItemParent  *parent,
         }
     }
 
+    if (elm_object_focus_allow_get(widget)) {
+        atk_state_set_add_state(state_set, ATK_STATE_FOCUSABLE);
+
+        if (EAIL_GENLIST(parent)->focused_item == it &&
+            elm_object_focus_get(widget)) {
+            atk_state_set_add_state(state_set, ATK_STATE_FOCUSED);
+        }
+    }
+
     atk_state_set_add_state(state_set, ATK_STATE_VISIBLE);
 
     list = elm_genlist_realized_items_get(widget);
@@ -309,7 +667,102 @@ eail_genlist_grab_item_focus(EailItemParent *parent,
         return FALSE;
     }
 
-    return FALSE;
+    elm_genlist_item_bring_in(it, ELM_GENLIST_ITEM_SCROLLTO_IN);
+    elm_object_focus_set(widget, EINA_TRUE);
+    if (!elm_object_focus_get(widget)) {
+        return FALSE;
+    }
+
+    EAIL_GENLIST(parent)->focused_item = it;
+    eail_focus_notify(ATK_OBJECT(item));
+
+    return TRUE;
+}
+
+/**
+ * @brief Implementation EailItemParent->item_deleted callback
+ *
+ * Deleted item may be followed by insertion keeping item count unchanged, so
+ * index to item map holding it is dropped.
+ *
+ * @param parent EailGenlist instance
+ * @param item deleted genlist item
+ */
+static void
+eail_genlist_item_deleted(EailItemParent *parent, Elm_Object_Item *item)
+{
+    EailGenlist *genlist = EAIL_GENLIST(parent);
+
+    if (genlist->focused_item == item) {
+        genlist->focused_item = NULL;
+    }
+
+    if (eina_hash_find(genlist->items_index, &item)) {
+        eail_genlist_items_invalidate(genlist);
+    }
+}
+
+/**
+ * @brief Gets cached rectangles of realized items, taking them if needed
+ *
+ * Rectangles are taken once per main loop iteration, i.e. once per frame,
+ * and dropped earlier when genlist scrolls, moves or realizes items.
+ *
+ * @param genlist an EailGenlist
+ * @param widget genlist Evas_Object
+ * @return Eina_Hash mapping realized Elm_Object_Item* to Eina_Rectangle*
+ */
+static Eina_Hash *
+eail_genlist_get_item_rects(EailGenlist *genlist, Evas_Object *widget)
+{
+    Eina_List *realized;
+    Elm_Object_Item *it;
+    Evas_Object *view;
+    Eina_Rectangle *rect;
+    Evas_Coord total = 0;
+    gint index, count = 0;
+
+    /* item map may be dropped only before rects are taken */
+    eail_genlist_items_validate(genlist, widget);
+
+    if (genlist->item_rects_time == ecore_loop_time_get()) {
+        return genlist->item_rects;
+    }
+
+    eina_hash_free_buckets(genlist->item_rects);
+    genlist->item_rects_first = genlist->item_rects_last = -1;
+    genlist->item_rects_height = 0;
+
+    realized = elm_genlist_realized_items_get(widget);
+    EINA_LIST_FREE(realized, it) {
+        view = eail_item_get_view(it);
+        if (!view) {
+            continue;
+        }
+
+        rect = malloc(sizeof(Eina_Rectangle));
+        evas_object_geometry_get(view, &rect->x, &rect->y, &rect->w, &rect->h);
+        eina_hash_add(genlist->item_rects, &it, rect);
+
+        index = eail_genlist_item_index(genlist, it);
+        if (genlist->item_rects_first < 0 ||
+            index < genlist->item_rects_first) {
+            genlist->item_rects_first = index;
+        }
+        if (index > genlist->item_rects_last) {
+            genlist->item_rects_last = index;
+        }
+
+        total += rect->h;
+        count++;
+    }
+
+    if (count) {
+        genlist->item_rects_height = total / count;
+    }
+    genlist->item_rects_time = ecore_loop_time_get();
+
+    return genlist->item_rects;
 }
 
 /**
@@ -333,12 +786,106 @@ eail_genlist_get_item_extents(EailItemParent    *parent,
                               gint                *height,
                               AtkCoordType         coord_type)
 {
+    EailGenlist *genlist = EAIL_GENLIST(parent);
     Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(parent));
     Elm_Object_Item *it = eail_item_get_item(item);
+    Elm_Object_Item *edge;
+    Eina_Hash *rects;
+    Eina_Rectangle *rect;
+    gint index, distance;
+
+    *x = *y = G_MININT;
+    *width = *height = -1;
 
     if (!widget || !it) {
         return;
     }
+
+    rects = eail_genlist_get_item_rects(genlist, widget);
+    rect = eina_hash_find(rects, &it);
+    if (rect) {
+        *x = rect->x;
+        *y = rect->y;
+        *width = rect->w;
+        *height = rect->h;
+    } else {
+        /* item is off-screen, place it before or after realized items */
+        index = eail_genlist_item_index(genlist, it);
+        if (index < 0 || genlist->item_rects_first < 0) {
+            return;
+        }
+
+        if (index < genlist->item_rects_first) {
+            edge = eail_genlist_item_nth(genlist, genlist->item_rects_first);
+            distance = index - genlist->item_rects_first;
+        } else {
+            edge = eail_genlist_item_nth(genlist, genlist->item_rects_last);
+            distance = index - genlist->item_rects_last;
+        }
+
+        rect = eina_hash_find(rects, &edge);
+        if (!rect) {
+            return;
+        }
+
+        *x = rect->x;
+        *y = rect->y + distance * genlist->item_rects_height;
+        *width = rect->w;
+        *height = genlist->item_rects_height;
+    }
+
+    if (coord_type == ATK_XY_SCREEN) {
+        int ee_x, ee_y;
+        Ecore_Evas *ee= ecore_evas_ecore_evas_get(evas_object_evas_get(widget));
+
+        ecore_evas_geometry_get(ee, &ee_x, &ee_y, NULL, NULL);
+        *x += ee_x;
+        *y += ee_y;
+    }
+}
+
+/**
+ * @brief Gets reference to item placed at given point
+ *
+ * Genlist finds the item itself, so items are not iterated.
+ *
+ * @param parent object that holds EailItem in its content
+ * @param x x coordinate
+ * @param y y coordinate
+ * @param coord_type specifies whether the coordinates are relative to the
+ * screen or to the components top level window
+ *
+ * @returns AtkObject* of item at given point or NULL if there is none
+ */
+static AtkObject *
+eail_genlist_ref_item_at_point(EailItemParent *parent,
+                               gint            x,
+                               gint            y,
+                               AtkCoordType    coord_type)
+{
+    Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(parent));
+    Elm_Object_Item *it;
+    int posret;
+
+    if (!widget) {
+        return NULL;
+    }
+
+    if (coord_type == ATK_XY_SCREEN) {
+        int ee_x, ee_y;
+        Ecore_Evas *ee= ecore_evas_ecore_evas_get(evas_object_evas_get(widget));
+
+        ecore_evas_geometry_get(ee, &ee_x, &ee_y, NULL, NULL);
+        x -= ee_x;
+        y -= ee_y;
+    }
+
+    it = elm_genlist_at_xy_item_get(widget, x, y, &posret);
+    if (!it) {
+        return NULL;
+    }
+
+    return eail_genlist_ref_item_accessible(EAIL_GENLIST(parent), it);
 }
 
 /**
@@ -352,12 +899,83 @@ eail_item_parent_interface_init(EailItemParentIface *iface)
     iface->ref_item_state_set = eail_genlist_ref_item_state_set;
     iface->grab_item_focus = eail_genlist_grab_item_focus;
     iface->get_item_extents = eail_genlist_get_item_extents;
+    iface->ref_item_at_point = eail_genlist_ref_item_at_point;
+    iface->item_deleted = eail_genlist_item_deleted;
 }
 
 /*
  * AtkSelection
  */
 
+/**
+ * @brief Selected item together with its index
+ */
+typedef struct
+{
+   gint index;/*!< index of item in genlist */
+   Elm_Object_Item *item;/*!< selected item */
+} EailGenlistSelected;
+
+/**
+ * @brief Compares selected items by their index
+ *
+ * @param a an EailGenlistSelected
+ * @param b an EailGenlistSelected
+ * @returns negative, zero or positive value if a goes before, together with
+ * or after b
+ */
+static gint
+eail_genlist_selected_compare(gconstpointer a, gconstpointer b)
+{
+   return ((const EailGenlistSelected *)a)->index -
+          ((const EailGenlistSelected *)b)->index;
+}
+
+/**
+ * @brief Gets selected items in child order
+ *
+ * Index is built once per selection change from selected items reported by
+ * genlist, so it costs O(k log k) for k selected items and is reused by
+ * subsequent requests.
+ *
+ * @param genlist an EailGenlist
+ * @returns Eina_Array of selected Elm_Object_Item* owned by genlist, NULL
+ * if widget is not available
+ */
+static Eina_Array *
+eail_genlist_get_selected(EailGenlist *genlist)
+{
+   Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(genlist));
+   const Eina_List *l;
+   Elm_Object_Item *item;
+   EailGenlistSelected selected;
+   GArray *sorted;
+   guint i;
+
+   if (!widget) return NULL;
+
+   /* validation may drop the index when items were added or deleted */
+   eail_genlist_items_validate(genlist, widget);
+   if (genlist->selected) return genlist->selected;
+
+   sorted = g_array_new(FALSE, FALSE, sizeof(EailGenlistSelected));
+   EINA_LIST_FOREACH(elm_genlist_selected_items_get(widget), l, item)
+     {
+        selected.index = eail_genlist_item_index(genlist, item);
+        selected.item = item;
+        if (selected.index >= 0) g_array_append_val(sorted, selected);
+     }
+   g_array_sort(sorted, eail_genlist_selected_compare);
+
+   genlist->selected = eina_array_new(MAX(sorted->len, 1));
+   for (i = 0; i < sorted->len; ++i)
+     eina_array_push(genlist->selected,
+                     g_array_index(sorted, EailGenlistSelected, i).item);
+   g_array_free(sorted, TRUE);
+
+   return genlist->selected;
+}
+
 /**
  * @brief Implementation of AtkSelection->add_selection callback
  *
@@ -371,15 +989,12 @@ eail_genlist_add_selection(AtkSelection *selection,
                            gint i)
 {
    g_return_val_if_fail(EAIL_IS_WIDGET(selection), FALSE);
-   Eina_List *items = eail_genlist_get_items(EAIL_GENLIST(selection));
-   Elm_Object_Item *item = eina_list_nth(items, i);
+   Elm_Object_Item *item = eail_genlist_item_nth(EAIL_GENLIST(selection), i);
 
    if (!item) return FALSE;
 
    elm_genlist_item_selected_set(item, EINA_TRUE);
 
-   eina_list_free(items);
-
    return TRUE;
 }
 
@@ -400,9 +1015,17 @@ static AtkObject *
 eail_genlist_ref_selection(AtkSelection *selection,
                         gint i)
 {
+   EailGenlist *genlist = EAIL_GENLIST(selection);
+   Eina_Array *selected;
+
    g_return_val_if_fail(EAIL_IS_WIDGET(selection), NULL);
 
-   return eail_genlist_ref_child(ATK_OBJECT(selection), i);
+   selected = eail_genlist_get_selected(genlist);
+   if (!selected || i < 0 || (unsigned int)i >= eina_array_count(selected))
+     return NULL;
+
+   return eail_genlist_ref_item_accessible(genlist,
+                                           eina_array_data_get(selected, i));
 }
 
 /**
@@ -449,26 +1072,14 @@ static gboolean
 eail_genlist_is_child_selected(AtkSelection *selection,
                                gint i)
 {
-   g_return_val_if_fail(EAIL_IS_WIDGET(selection), FALSE);
-   Evas_Object *object = eail_widget_get_widget(EAIL_WIDGET(selection));
-   Elm_Object_Item *selected_item = elm_genlist_selected_item_get(object);
-   Elm_Object_Item *last_item = elm_genlist_last_item_get(object);
-   Elm_Object_Item *item = elm_genlist_first_item_get(object);
-   gint n = 0;
-
-   /* of course if there is no selected object, that naturally means that none
-    * of children is selected */
-   if (!selected_item) return FALSE;
+   Elm_Object_Item *item;
 
-   do
-     {
-        if (selected_item == item) break;
+   g_return_val_if_fail(EAIL_IS_WIDGET(selection), FALSE);
 
-        item = elm_genlist_item_next_get(item);
-        n++;
-     } while (item != last_item);
+   item = eail_genlist_item_nth(EAIL_GENLIST(selection), i);
+   if (!item) return FALSE;
 
-   return i == n;
+   return elm_genlist_item_selected_get(item);
 }
 
 /**
@@ -486,7 +1097,6 @@ static gboolean
 eail_genlist_remove_selection(AtkSelection *selection,
                               gint i)
 {
-   Eina_List *items = NULL;
    Evas_Object *object = NULL;
    Elm_Object_Item *item = NULL;
 
@@ -494,14 +1104,11 @@ eail_genlist_remove_selection(AtkSelection *selection,
    object = eail_widget_get_widget(EAIL_WIDGET(selection));
    g_return_val_if_fail(object, FALSE);
 
-   items = eail_genlist_get_items(EAIL_GENLIST(selection));
-   g_return_val_if_fail((eina_list_count(items) > i), FALSE);
+   item = eail_genlist_item_nth(EAIL_GENLIST(selection), i);
+   g_return_val_if_fail(item, FALSE);
 
-   item = eina_list_nth(items, i);
    elm_genlist_item_selected_set(item, EINA_FALSE);
 
-   eina_list_free(items);
-
    /* if change was successful, then selected item now should be different */
    return (elm_genlist_selected_item_get(object) != item);
 }
@@ -510,6 +1117,11 @@ eail_genlist_remove_selection(AtkSelection *selection,
  * @brief Helper function that selects/unselects all items in the list depending
  * on "selected" param value
  *
+ * Evas events and edje recalculation are frozen during the sweep, so the
+ * genlist is laid out once. Only items which change their state are
+ * touched: all items when selecting, only selected ones when clearing.
+ * Single "selection-changed" signal is emitted at the end.
+ *
  * @param selection an AtkSelection
  * @param selected selected state (TRUE means selected)
  *
@@ -519,19 +1131,46 @@ static gboolean
 eail_genlist_mark_all_selected_state(AtkSelection *selection,
                                      Eina_Bool selected)
 {
-   Eina_List *items = NULL;
-   int i = 0;
+   Evas_Object *object = eail_widget_get_widget(EAIL_WIDGET(selection));
+   Evas *evas;
+   Eina_List *selected_items;
+   Elm_Object_Item *item;
+   gboolean changed = FALSE;
 
-   items = eail_genlist_get_items(EAIL_GENLIST(selection));
-   for (i = 0; i < eina_list_count(items); ++i)
-     {
-        Elm_Object_Item *item = eina_list_nth(items, i);
-        if (!item) return FALSE;
+   if (!object) return FALSE;
+
+   evas = evas_object_evas_get(object);
+   evas_event_freeze(evas);
+   edje_freeze();
 
-        elm_genlist_item_selected_set(item, selected);
+   if (selected)
+     {
+        for (item = elm_genlist_first_item_get(object); item;
+             item = elm_genlist_item_next_get(item))
+          {
+             if (elm_genlist_item_selected_get(item)) continue;
+
+             elm_genlist_item_selected_set(item, EINA_TRUE);
+             changed = TRUE;
+          }
+     }
+   else
+     {
+        /* selected items list is modified while unselecting */
+        selected_items =
+           eina_list_clone(elm_genlist_selected_items_get(object));
+        EINA_LIST_FREE(selected_items, item)
+          {
+             elm_genlist_item_selected_set(item, EINA_FALSE);
+             changed = TRUE;
+          }
      }
 
-   eina_list_free(items);
+   edje_thaw();
+   evas_event_thaw(evas);
+
+   if (changed)
+     g_signal_emit_by_name(selection, "selection-changed");
 
    return TRUE;
 }
@@ -589,3 +1228,240 @@ static void atk_selection_interface_init(AtkSelectionIface *iface)
    iface->remove_selection     = eail_genlist_remove_selection;
    iface->select_all_selection = eail_genlist_select_all_selection;
 }
+
+/*
+ * Implementation of the *AtkTable* interface
+ *
+ * Genlist items are laid out one below another, so every item is a row
+ * with single cell, and row of item is its child index.
+ */
+
+/**
+ * @brief Implementation of AtkTable->get_n_rows callback
+ *
+ * @param table an AtkTable
+ *
+ * @returns number of rows, which is number of items
+ */
+static gint
+eail_genlist_get_n_rows(AtkTable *table)
+{
+   g_return_val_if_fail(EAIL_IS_GENLIST(table), 0);
+
+   return eail_genlist_get_n_children(ATK_OBJECT(table));
+}
+
+/**
+ * @brief Implementation of AtkTable->get_n_columns callback
+ *
+ * @param table an AtkTable
+ *
+ * @returns 1 if genlist has items, 0 otherwise
+ */
+static gint
+eail_genlist_get_n_columns(AtkTable *table)
+{
+   g_return_val_if_fail(EAIL_IS_GENLIST(table), 0);
+
+   return eail_genlist_get_n_children(ATK_OBJECT(table)) ? 1 : 0;
+}
+
+/**
+ * @brief Implementation of AtkTable->get_index_at callback
+ *
+ * @param table an AtkTable
+ * @param row row number
+ * @param column column number
+ *
+ * @returns index of item at given position, -1 if there is none
+ */
+static gint
+eail_genlist_get_index_at(AtkTable *table, gint row, gint column)
+{
+   g_return_val_if_fail(EAIL_IS_GENLIST(table), -1);
+
+   if (column != 0 || row < 0 ||
+       row >= eail_genlist_get_n_children(ATK_OBJECT(table)))
+     return -1;
+
+   return row;
+}
+
+/**
+ * @brief Implementation of AtkTable->ref_at callback
+ *
+ * @param table an AtkTable
+ * @param row row number
+ * @param column column number
+ *
+ * @returns referred item at given position
+ */
+static AtkObject *
+eail_genlist_ref_at(AtkTable *table, gint row, gint column)
+{
+   gint index = eail_genlist_get_index_at(table, row, column);
+
+   if (index == -1) return NULL;
+
+   return eail_genlist_ref_child(ATK_OBJECT(table), index);
+}
+
+/**
+ * @brief Implementation of AtkTable->get_row_at_index callback
+ *
+ * @param table an AtkTable
+ * @param index index of item
+ *
+ * @returns row of item, -1 if there is no such item
+ */
+static gint
+eail_genlist_get_row_at_index(AtkTable *table, gint index)
+{
+   g_return_val_if_fail(EAIL_IS_GENLIST(table), -1);
+
+   if (index < 0 || index >= eail_genlist_get_n_children(ATK_OBJECT(table)))
+     return -1;
+
+   return index;
+}
+
+/**
+ * @brief Implementation of AtkTable->get_column_at_index callback
+ *
+ * @param table an AtkTable
+ * @param index index of item
+ *
+ * @returns 0, -1 if there is no such item
+ */
+static gint
+eail_genlist_get_column_at_index(AtkTable *table, gint index)
+{
+   return (eail_genlist_get_row_at_index(table, index) == -1) ? -1 : 0;
+}
+
+/**
+ * @brief Implementation of AtkTable->get_row_extent_at and
+ * get_column_extent_at callbacks
+ *
+ * @param table an AtkTable
+ * @param row row number
+ * @param column column number
+ *
+ * @returns 1 if there is item at given position, 0 otherwise
+ */
+static gint
+eail_genlist_get_extent_at(AtkTable *table, gint row, gint column)
+{
+   return (eail_genlist_get_index_at(table, row, column) == -1) ? 0 : 1;
+}
+
+/**
+ * @brief Implementation of AtkTable->is_row_selected callback
+ *
+ * @param table an AtkTable
+ * @param row row number
+ *
+ * @returns TRUE if item in given row is selected, FALSE otherwise
+ */
+static gboolean
+eail_genlist_is_row_selected(AtkTable *table, gint row)
+{
+   return eail_genlist_is_child_selected(ATK_SELECTION(table), row);
+}
+
+/**
+ * @brief Implementation of AtkTable->is_selected callback
+ *
+ * @param table an AtkTable
+ * @param row row number
+ * @param column column number
+ *
+ * @returns TRUE if item at given position is selected, FALSE otherwise
+ */
+static gboolean
+eail_genlist_is_selected(AtkTable *table, gint row, gint column)
+{
+   if (column != 0) return FALSE;
+
+   return eail_genlist_is_row_selected(table, row);
+}
+
+/**
+ * @brief Implementation of AtkTable->get_selected_rows callback
+ *
+ * Rows are taken from index of selected items, which is kept in child order.
+ *
+ * @param table an AtkTable
+ * @param selected address to store newly allocated array of selected rows
+ *
+ * @returns number of selected rows
+ */
+static gint
+eail_genlist_get_selected_rows(AtkTable *table, gint **selected)
+{
+   EailGenlist *genlist;
+   Eina_Array *items;
+   gint i, n_selected;
+
+   g_return_val_if_fail(EAIL_IS_GENLIST(table), 0);
+   genlist = EAIL_GENLIST(table);
+
+   items = eail_genlist_get_selected(genlist);
+   n_selected = items ? eina_array_count(items) : 0;
+   if (!selected) return n_selected;
+
+   *selected = g_new(gint, n_selected);
+   for (i = 0; i < n_selected; i++)
+     (*selected)[i] =
+        eail_genlist_item_index(genlist, eina_array_data_get(items, i));
+
+   return n_selected;
+}
+
+/**
+ * @brief Implementation of AtkTable->add_row_selection callback
+ *
+ * @param table an AtkTable
+ * @param row row number
+ *
+ * @returns TRUE on success, FALSE otherwise
+ */
+static gboolean
+eail_genlist_add_row_selection(AtkTable *table, gint row)
+{
+   return eail_genlist_add_selection(ATK_SELECTION(table), row);
+}
+
+/**
+ * @brief Implementation of AtkTable->remove_row_selection callback
+ *
+ * @param table an AtkTable
+ * @param row row number
+ *
+ * @returns TRUE on success, FALSE otherwise
+ */
+static gboolean
+eail_genlist_remove_row_selection(AtkTable *table, gint row)
+{
+   return eail_genlist_remove_selection(ATK_SELECTION(table), row);
+}
+
+/**
+ * Initializer of AtkTableIface interface
+ */
+static void atk_table_interface_init(AtkTableIface *iface)
+{
+   iface->ref_at               = eail_genlist_ref_at;
+   iface->get_index_at         = eail_genlist_get_index_at;
+   iface->get_row_at_index     = eail_genlist_get_row_at_index;
+   iface->get_column_at_index  = eail_genlist_get_column_at_index;
+   iface->get_n_rows           = eail_genlist_get_n_rows;
+   iface->get_n_columns        = eail_genlist_get_n_columns;
+   iface->get_row_extent_at    = eail_genlist_get_extent_at;
+   iface->get_column_extent_at = eail_genlist_get_extent_at;
+   iface->is_row_selected      = eail_genlist_is_row_selected;
+   iface->is_selected          = eail_genlist_is_selected;
+   iface->get_selected_rows    = eail_genlist_get_selected_rows;
+   iface->add_row_selection    = eail_genlist_add_row_selection;
+   iface->remove_row_selection = eail_genlist_remove_row_selection;
+}
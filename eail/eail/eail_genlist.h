@@ -48,6 +48,21 @@ typedef struct _EailGenlistClass EailGenlistClass;
 struct _EailGenlist
 {
    EailScrollableWidget parent;
+
+   Eina_Array *items;/*!< lazily filled index to Elm_Object_Item* map */
+   Eina_Hash *items_index;/*!< Elm_Object_Item* to its index + 1 */
+   unsigned int items_count;/*!< genlist items count when map was filled */
+   Eina_Array *selected;/*!< selected items in child order, NULL if not
+                          fetched */
+   Eina_Hash *item_rects;/*!< realized Elm_Object_Item* to its canvas
+                           Eina_Rectangle* */
+   double item_rects_time;/*!< main loop time rects were taken at, rects
+                            are valid for one frame */
+   gint item_rects_first;/*!< index of first realized item */
+   gint item_rects_last;/*!< index of last realized item */
+   Evas_Coord item_rects_height;/*!< average height of realized items */
+   Elm_Object_Item *focused_item;/*!< item focus was grabbed for, NULL if
+                                   none */
 };
 
 struct _EailGenlistClass
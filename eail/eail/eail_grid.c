@@ -26,12 +26,19 @@
 
 #include "eail_grid.h"
 
+static void atk_table_interface_init(AtkTableIface *iface);
+
 /**
  * @def Definition of EailGrid as GObject
  *
- * EailGrid is extended EAIL_TYPE_WIDGET
+ * EailGrid is extended EAIL_TYPE_WIDGET with ATK_TYPE_TABLE interface
+ * implemented
  */
-G_DEFINE_TYPE(EailGrid, eail_grid, EAIL_TYPE_WIDGET)
+G_DEFINE_TYPE_WITH_CODE(EailGrid,
+                        eail_grid,
+                        EAIL_TYPE_WIDGET,
+                        G_IMPLEMENT_INTERFACE(ATK_TYPE_TABLE,
+                                              atk_table_interface_init))
 
 /**
  * @brief Implementation of eail_widget_get_widget_children callback from
@@ -70,6 +77,19 @@ eail_grid_initialize(AtkObject *obj, gpointer data)
 static void
 eail_grid_init(EailGrid *grid)
 {
+   grid->cells = NULL;
+   grid->cells_serial = 0;
+}
+
+/**
+ * @brief Finalizer for GObject
+ */
+static void
+eail_grid_finalize(GObject *object)
+{
+   eail_cell_index_free(EAIL_GRID(object)->cells);
+
+   G_OBJECT_CLASS(eail_grid_parent_class)->finalize(object);
 }
 
 /**
@@ -81,8 +101,71 @@ eail_grid_class_init(EailGridClass *klass)
 {
    AtkObjectClass *class = ATK_OBJECT_CLASS(klass);
    EailWidgetClass *widget_class = EAIL_WIDGET_CLASS(klass);
+   GObjectClass *gobject_class = G_OBJECT_CLASS(klass);
 
    widget_class->get_widget_children = eail_grid_children_get;
 
    class->initialize = eail_grid_initialize;
+
+   gobject_class->finalize = eail_grid_finalize;
+}
+
+/**
+ * @brief Gets virtual geometry of child packed in grid
+ *
+ * @param child child of grid
+ * @param row pointer to store y of child
+ * @param column pointer to store x of child
+ * @param row_span pointer to store height of child
+ * @param column_span pointer to store width of child
+ */
+static void
+eail_grid_pack_get(Evas_Object *child, gint *row, gint *column,
+                   gint *row_span, gint *column_span)
+{
+   elm_grid_pack_get(child, column, row, column_span, row_span);
+}
+
+/**
+ * @brief Gets cells of grid children
+ *
+ * Cells are taken from virtual geometry given to elm_grid_pack once per
+ * change of children, that is when content is packed or unpacked, or grid
+ * size hints change because content has been packed again. Distinct
+ * coordinates children start at make rows and columns.
+ *
+ * @param table EailGrid instance
+ *
+ * @returns cell index of children
+ */
+static EailCellIndex *
+eail_grid_cells_get(AtkTable *table)
+{
+   EailGrid *grid = EAIL_GRID(table);
+   EailWidget *widget = EAIL_WIDGET(table);
+   Eina_Array *children = eail_widget_get_cached_children(widget);
+
+   if (grid->cells && grid->cells_serial == widget->children_serial &&
+       eail_cell_index_is_valid(grid->cells))
+     return grid->cells;
+
+   eail_cell_index_free(grid->cells);
+   grid->cells = eail_cell_index_new_for_children
+      (widget->widget, children, eail_grid_pack_get, TRUE);
+   grid->cells_serial = widget->children_serial;
+
+   return grid->cells;
+}
+
+/**
+ * @brief AtkTable interface initialization
+ *
+ * @param iface AtkTable interface
+ */
+static void
+atk_table_interface_init(AtkTableIface *iface)
+{
+   if (!iface) return;
+
+   eail_cell_index_table_interface_init(iface, eail_grid_cells_get);
 }
@@ -21,6 +21,7 @@
 #define EAIL_GRID_H
 
 #include "eail_widget.h"
+#include "eail_cell_index.h"
 
 #define EAIL_TYPE_GRID              (eail_grid_get_type())
 #define EAIL_GRID(obj)              (G_TYPE_CHECK_INSTANCE_CAST((obj), \
@@ -44,6 +45,9 @@ typedef struct _EailGridClass EailGridClass;
 struct _EailGrid
 {
    EailWidget parent;
+
+   EailCellIndex *cells; /*!< cells of children, NULL if not built yet*/
+   unsigned int cells_serial; /*!< children serial cells were built for*/
 };
 
 struct _EailGridClass
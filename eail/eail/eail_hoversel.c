@@ -203,10 +203,8 @@ eail_hoversel_ref_child(AtkObject *obj,
    items = eail_hoversel_items_get(EAIL_HOVERSEL(obj));
    if (eina_list_count(items) > i)
      {
-        child = eail_item_new(obj, ATK_ROLE_LABEL);
-        atk_object_initialize(child, eina_list_nth(items, i));
-
-        g_object_ref(child);
+        child = eail_item_parent_ref_item_accessible
+           (EAIL_ITEM_PARENT(obj), eina_list_nth(items, i), ATK_ROLE_LABEL);
      }
    else
      ERR("Tried to ref child with index %d out of bounds!", i);
@@ -81,11 +81,6 @@ eail_image_initialize(AtkObject *obj, gpointer data)
    ATK_OBJECT_CLASS(eail_image_parent_class)->initialize(obj, data);
 
    obj->role = ATK_ROLE_IMAGE;
-
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(obj),
-                                    EAIL_IMAGE_ACTION_CLICK,
-                                    NULL,
-                                    _eail_image_action_click);
 }
 
 /**
@@ -160,6 +155,9 @@ eail_image_ref_state_set(AtkObject *obj)
 static void
 eail_image_class_init(EailImageClass *klass)
 {
+   static const EailActionDef actions[] = {
+        {EAIL_IMAGE_ACTION_CLICK, NULL, _eail_image_action_click}
+   };
    AtkObjectClass *class = ATK_OBJECT_CLASS(klass);
    GObjectClass *g_object_class = G_OBJECT_CLASS(klass);
 
@@ -167,6 +165,9 @@ eail_image_class_init(EailImageClass *klass)
    class->ref_state_set = eail_image_ref_state_set;
 
    g_object_class->finalize = eail_image_finalize;
+
+   eail_action_widget_class_actions_append(EAIL_ACTION_WIDGET_CLASS(klass),
+                                           actions, G_N_ELEMENTS(actions));
 }
 
 /*
@@ -23,6 +23,9 @@
  * list/toolbar/menu items
 */
 
+#include <stdint.h>
+#include <string.h>
+
 #include "eail_item.h"
 #include "eail_item_parent.h"
 #include "eail_factory.h"
@@ -32,6 +35,7 @@
 static void atk_component_interface_init(AtkComponentIface *iface);
 static void atk_action_interface_init(AtkActionIface *iface);
 static void atk_text_interface_init(AtkTextIface *iface);
+static void _eail_item_drop_parts(EailItem *item);
 
 /**
  * @brief EailItem GObject definition
@@ -99,6 +103,54 @@ eail_item_get_item(EailItem *item)
    return item->item;
 }
 
+/**
+ * @brief Drops cached text of item
+ *
+ * @param item an EailItem
+ */
+void
+eail_item_invalidate_text(EailItem *item)
+{
+   g_return_if_fail(EAIL_IS_ITEM(item));
+
+   eail_text_buffer_free(item->buffer);
+   item->buffer = NULL;
+}
+
+/**
+ * @brief Drops cached text and content parts of item
+ *
+ * Used by item containers when item view is (re)created, e.g. after
+ * elm_genlist_item_update.
+ *
+ * @param item an EailItem
+ */
+void
+eail_item_invalidate_view(EailItem *item)
+{
+   g_return_if_fail(EAIL_IS_ITEM(item));
+
+   eail_item_invalidate_text(item);
+   _eail_item_drop_parts(item);
+}
+
+/**
+ * @brief Drops nested Elm_Object_Item together with everything cached
+ * from it
+ *
+ * Used when item is deleted while its accessible is still referenced.
+ *
+ * @param item an EailItem
+ */
+void
+eail_item_invalidate_item(EailItem *item)
+{
+   g_return_if_fail(EAIL_IS_ITEM(item));
+
+   eail_item_invalidate_view(item);
+   item->item = NULL;
+}
+
 /*
  * Implementation of the *AtkObject* interface
  */
@@ -176,6 +228,20 @@ eail_item_get_index_in_parent(AtkObject *obj)
                                                     EAIL_ITEM(obj));
 }
 
+/**
+ * @brief Implementation of AtkObject->get_attributes callback
+ *
+ * Items of containers implementing AtkTable report their cell position.
+ *
+ * @returns an AtkAttributeSet consisting of all of the explicitly set
+ * attributes for this object
+ */
+static AtkAttributeSet *
+eail_item_get_attributes(AtkObject *obj)
+{
+   return eail_table_cell_attributes_append(NULL, obj);
+}
+
 /**
  * @brief Implementation of AtkObject->ref_state_set callback
  *
@@ -219,6 +285,8 @@ eail_item_ref_state_set(AtkObject *obj)
 static void
 eail_item_init(EailItem *item)
 {
+   item->buffer = NULL;
+   item->parts = NULL;
 }
 
 /**
@@ -227,6 +295,10 @@ eail_item_init(EailItem *item)
 static void
 eail_item_class_finalize(GObject *obj)
 {
+   EailItem *item = EAIL_ITEM(obj);
+
+   eail_item_invalidate_view(item);
+
    G_OBJECT_CLASS(eail_item_parent_class)->finalize(obj);
 }
 
@@ -280,42 +352,141 @@ _eail_item_get_basic_parts(Elm_Object_Item *obj_item)
 }
 
 /**
- * @brief Helper function that adds unique entries from one list to another
+ * @brief Number of slots of part set kept on stack
+ */
+#define EAIL_ITEM_PART_SET_SIZE 32
+
+/**
+ * @brief Small open-addressing set of content parts
+ */
+typedef struct
+{
+   const void **slots;/*!< hash slots, NULL for empty one */
+   unsigned int mask;/*!< number of slots minus one */
+   const void *inline_slots[EAIL_ITEM_PART_SET_SIZE];/*!< slots for small
+                                                       sets */
+} EailItemPartSet;
+
+/**
+ * @brief Initializes part set large enough for given number of parts
  *
- * @param item_list source list, unique items will be appended here
- * @param additional_items list with potential items to add
+ * @param set an EailItemPartSet
+ * @param n_parts maximal number of parts to be added
+ */
+static void
+_eail_item_part_set_init(EailItemPartSet *set, unsigned int n_parts)
+{
+   unsigned int size = EAIL_ITEM_PART_SET_SIZE;
+
+   /* keep load factor below one half */
+   while (size < 2 * n_parts) size *= 2;
+
+   if (size == EAIL_ITEM_PART_SET_SIZE)
+     {
+        memset(set->inline_slots, 0, sizeof(set->inline_slots));
+        set->slots = set->inline_slots;
+     }
+   else
+     set->slots = g_new0(const void *, size);
+
+   set->mask = size - 1;
+}
+
+/**
+ * @brief Frees part set
  *
- * @returns result list filled with unique entries from both lists
+ * @param set an EailItemPartSet
  */
-static Eina_List *
-_eail_add_unique_listsparts(Eina_List *item_list,
-                            Eina_List *additional_items)
+static void
+_eail_item_part_set_shutdown(EailItemPartSet *set)
 {
-   Eina_List *l = NULL;
-   Elm_Object_Item *item_edj;
+   if (set->slots != set->inline_slots) g_free(set->slots);
+}
 
-   EINA_LIST_FOREACH(additional_items, l, item_edj)
-    {
-      if (!eina_list_data_find(item_list, item_edj))
-        item_list = eina_list_append(item_list, item_edj);
-    }
+/**
+ * @brief Adds part to set
+ *
+ * @param set an EailItemPartSet
+ * @param part part to add
+ *
+ * @returns EINA_TRUE if part was added, EINA_FALSE if it was already in set
+ */
+static Eina_Bool
+_eail_item_part_set_add(EailItemPartSet *set, const void *part)
+{
+   unsigned int i;
 
-   return item_list;
+   i = (unsigned int)(((uintptr_t)part >> 4) * 2654435761u) & set->mask;
+   while (set->slots[i])
+     {
+        if (set->slots[i] == part) return EINA_FALSE;
+        i = (i + 1) & set->mask;
+     }
+
+   set->slots[i] = part;
+   return EINA_TRUE;
 }
 
 /**
- * @brief Gets content part items from given EailItem object
+ * @brief Callback for deletion of cached content part, drops parts cache
+ *
+ * @param data an EailItem
+ * @param e an Evas
+ * @param obj deleted content part
+ * @param event_info additional event info (not used here)
+ */
+static void _eail_item_on_part_del(void *data, Evas *e, Evas_Object *obj,
+                                   void *event_info);
+
+/**
+ * @brief Drops cached content parts of item
+ *
+ * @param item an EailItem
+ */
+static void
+_eail_item_drop_parts(EailItem *item)
+{
+   Evas_Object *part;
+   Eina_Array_Iterator iter;
+   unsigned int i;
+
+   if (!item->parts) return;
+
+   EINA_ARRAY_ITER_NEXT(item->parts, i, part, iter)
+     evas_object_event_callback_del_full(part, EVAS_CALLBACK_DEL,
+                                         _eail_item_on_part_del, item);
+
+   eina_array_free(item->parts);
+   item->parts = NULL;
+}
+
+static void
+_eail_item_on_part_del(void *data, Evas *e, Evas_Object *obj,
+                       void *event_info)
+{
+   _eail_item_drop_parts(EAIL_ITEM(data));
+}
+
+/**
+ * @brief Gets content parts of given EailItem object
+ *
+ * Parts are collected in one pass and deduplicated with a small hash set,
+ * then cached until item is realized again or one of parts is deleted.
  *
  * @param eail_item EailItem object used to get content from
  *
- * @returns content parts (Evas_Object *) for given item. List should be freed
- * when results will be processed.
+ * @returns Eina_Array of content parts (Evas_Object *) owned by item, NULL
+ * if item is not available
  */
-static Eina_List *
+static Eina_Array *
 _eail_item_get_part_items(EailItem *eail_item)
 {
    Eina_List *items = NULL, *edje_items = NULL;
    Elm_Object_Item *obj_item = NULL;
+   EailItemPartSet set;
+   Evas_Object *part;
+
+   if (eail_item->parts) return eail_item->parts;
 
    obj_item = eail_item_get_item(eail_item);
    g_return_val_if_fail(obj_item, NULL);
@@ -329,12 +500,23 @@ _eail_item_get_part_items(EailItem *eail_item)
    /* content parts from taken from edje object*/
    edje_items = eail_get_edje_parts_for_item(obj_item);
 
-   /* adding unique edje items to content list*/
-   items = _eail_add_unique_listsparts(items, edje_items);
+   _eail_item_part_set_init(&set, eina_list_count(items) +
+                                  eina_list_count(edje_items));
+   eail_item->parts = eina_array_new(4);
 
-   eina_list_free(edje_items);
+   items = eina_list_merge(items, edje_items);
+   EINA_LIST_FREE(items, part)
+     {
+        if (!_eail_item_part_set_add(&set, part)) continue;
 
-   return items;
+        eina_array_push(eail_item->parts, part);
+        evas_object_event_callback_add(part, EVAS_CALLBACK_DEL,
+                                       _eail_item_on_part_del, eail_item);
+     }
+
+   _eail_item_part_set_shutdown(&set);
+
+   return eail_item->parts;
 }
 
 /**
@@ -369,19 +551,16 @@ _eail_item_is_content_get_supported(AtkObject *atk_object)
 static gint
 eail_item_get_n_children(AtkObject *obj)
 {
-   gint n_items;
-   Eina_List *items;
+   Eina_Array *items;
 
    /* if content_get is not supported then child count will be always '0'*/
    if (!_eail_item_is_content_get_supported(obj))
      return 0;
 
    items = _eail_item_get_part_items(EAIL_ITEM(obj));
-   n_items = eina_list_count(items);
-
-   eina_list_free(items);
+   if (!items) return 0;
 
-   return n_items;
+   return eina_array_count(items);
 }
 
 /**
@@ -398,17 +577,18 @@ eail_item_get_n_children(AtkObject *obj)
 static AtkObject *
 eail_item_ref_child(AtkObject *obj, gint i)
 {
-   Eina_List *items;
+   Eina_Array *items;
    AtkObject *child = NULL;
 
    items = _eail_item_get_part_items(EAIL_ITEM(obj));
-   if (eina_list_count(items) > i)
-     child = eail_factory_get_accessible(eina_list_nth(items, i));
+   if (items && i >= 0 && eina_array_count(items) > (unsigned int)i)
+     {
+        child = eail_factory_get_accessible(eina_array_data_get(items, i));
+        if (child) g_object_ref(child);
+     }
    else
       ERR("Tried to ref child with index %d out of bounds!", i);
 
-   eina_list_free(items);
-
    return child;
 }
 
@@ -425,6 +605,7 @@ eail_item_class_init(EailItemClass *klass)
    class->get_name = eail_item_get_name;
    class->get_role = eail_item_get_role;
    class->get_index_in_parent = eail_item_get_index_in_parent;
+   class->get_attributes = eail_item_get_attributes;
    class->ref_state_set = eail_item_ref_state_set;
    class->get_n_children = eail_item_get_n_children;
    class->ref_child = eail_item_ref_child;
@@ -491,6 +672,84 @@ eail_item_get_extents(AtkComponent    *component,
                                      x, y, width, height, coord_type);
 }
 
+/**
+ * @brief Implementation of AtkComponent->contains callback
+ *
+ * ATK doc says:
+ * Checks whether the specified point is within the extent of the component.
+ *
+ * @param component an AtkComponent
+ * @param x x coordinate
+ * @param y y coordinate
+ * @param coord_type specifies whether the coordinates are relative to the
+ * screen or to the components top level window
+ *
+ * @returns TRUE if point is within component, FALSE otherwise
+ */
+static gboolean
+eail_item_contains(AtkComponent *component,
+                   gint          x,
+                   gint          y,
+                   AtkCoordType  coord_type)
+{
+   gint item_x, item_y, width, height;
+
+   eail_item_get_extents(component, &item_x, &item_y, &width, &height,
+                         coord_type);
+   if (width < 0 || height < 0) return FALSE;
+
+   return x >= item_x && y >= item_y &&
+          x < item_x + width && y < item_y + height;
+}
+
+/**
+ * @brief Implementation of AtkComponent->ref_accessible_at_point callback
+ *
+ * ATK doc says:
+ * Gets a reference to the accessible child, if one exists, at the coordinate
+ * point specified by x and y.
+ *
+ * Only content parts of the item are checked, without creating accessibles
+ * for remaining children.
+ *
+ * @param component an AtkComponent
+ * @param x x coordinate
+ * @param y y coordinate
+ * @param coord_type specifies whether the coordinates are relative to the
+ * screen or to the components top level window
+ *
+ * @returns AtkObject* child at given point or NULL if there is none
+ */
+static AtkObject *
+eail_item_ref_accessible_at_point(AtkComponent *component,
+                                  gint          x,
+                                  gint          y,
+                                  AtkCoordType  coord_type)
+{
+   AtkObject *obj = ATK_OBJECT(component);
+   Eina_Array *items;
+   Eina_Array_Iterator iter;
+   Evas_Object *part;
+   unsigned int i;
+
+   if (!_eail_item_is_content_get_supported(obj)) return NULL;
+   if (!eail_item_contains(component, x, y, coord_type)) return NULL;
+
+   items = _eail_item_get_part_items(EAIL_ITEM(obj));
+   if (!items) return NULL;
+
+   EINA_ARRAY_ITER_NEXT(items, i, part, iter)
+     {
+        AtkObject *part_obj = eail_factory_get_accessible(part);
+
+        if (part_obj && ATK_IS_COMPONENT(part_obj) &&
+            atk_component_contains(ATK_COMPONENT(part_obj), x, y, coord_type))
+          return g_object_ref(part_obj);
+     }
+
+   return NULL;
+}
+
 /**
  * @brief Initializer for AtkComponentIface
  */
@@ -499,6 +758,8 @@ atk_component_interface_init(AtkComponentIface *iface)
 {
    iface->grab_focus  = eail_item_grab_focus;
    iface->get_extents = eail_item_get_extents;
+   iface->contains = eail_item_contains;
+   iface->ref_accessible_at_point = eail_item_ref_accessible_at_point;
 }
 
 /*
@@ -647,34 +908,34 @@ atk_action_interface_init(AtkActionIface *iface)
 }
 
 /**
- * @brief Gets text content from item
+ * @brief Gets text of item, indexing it again only if it changed
  *
- * Implementation of AtkTextIface->get_text callback\n
+ * Texts of all text parts of item are joined with EAIL_TXT_SEPARATOR on every
+ * request, as not every item container tells when item text changes, e.g.
+ * after elm_object_item_part_text_set. Comparing joined text with cached one
+ * is much cheaper than indexing it again.
  *
- * @param text an AtkText
- * @param start_offset start position
- * @param end_offset end position, or -1 for the end of the string.
+ * @param item an EailItem
  *
- * @returns a newly allocated string containing the text from start_offset
- * up to, but not including end_offset. Use g_free() to free the returned
- * string.
+ * @returns EailTextBuffer owned by item or NULL if item has no text
  */
-static gchar*
-eail_item_get_text(AtkText   *text,
-                   gint       start_offset,
-                   gint       end_offset)
+static EailTextBuffer *
+_eail_item_get_text_buffer(EailItem *item)
 {
    Eina_Strbuf *buf = NULL;
    Elm_Object_Item *obj_item = NULL;
    Eina_List *string_parts = NULL, *l = NULL;
    gchar *string_part = NULL;
-   gchar *ret_str = NULL;
 
-   obj_item = eail_item_get_item(EAIL_ITEM(text));
+   obj_item = eail_item_get_item(item);
    g_return_val_if_fail(obj_item, NULL);
 
    string_parts = eail_item_get_content_strings(obj_item);
-   if (!string_parts) return NULL;
+   if (!string_parts)
+     {
+        eail_item_invalidate_text(item);
+        return NULL;
+     }
 
    buf = eina_strbuf_new();
    EINA_LIST_FOREACH(string_parts, l, string_part)
@@ -683,14 +944,43 @@ eail_item_get_text(AtkText   *text,
        eina_strbuf_append(buf, EAIL_TXT_SEPARATOR);
     }
 
-   /* ret_str is newly allocated */
-   ret_str = eail_get_substring
-                     (eina_strbuf_string_get(buf), start_offset, end_offset);
+   if (!item->buffer ||
+       g_strcmp0(item->buffer->text, eina_strbuf_string_get(buf)))
+     {
+        eail_text_buffer_free(item->buffer);
+        item->buffer = eail_text_buffer_new(eina_strbuf_string_get(buf));
+     }
 
    eina_list_free(string_parts);
    eina_strbuf_free(buf);
 
-   return ret_str;
+   return item->buffer;
+}
+
+/**
+ * @brief Gets text content from item
+ *
+ * Implementation of AtkTextIface->get_text callback\n
+ *
+ * @param text an AtkText
+ * @param start_offset start position
+ * @param end_offset end position, or -1 for the end of the string.
+ *
+ * @returns a newly allocated string containing the text from start_offset
+ * up to, but not including end_offset. Use g_free() to free the returned
+ * string.
+ */
+static gchar*
+eail_item_get_text(AtkText   *text,
+                   gint       start_offset,
+                   gint       end_offset)
+{
+   EailTextBuffer *buffer = NULL;
+
+   buffer = _eail_item_get_text_buffer(EAIL_ITEM(text));
+   if (!buffer) return NULL;
+
+   return eail_text_buffer_get_text(buffer, start_offset, end_offset);
 }
 
 /**
@@ -706,19 +996,12 @@ eail_item_get_text(AtkText   *text,
 static gunichar
 eail_item_get_character_at_offset(AtkText *text, gint offset)
 {
-   gunichar character = '\0';
-   gchar* time_str = NULL;
+   EailTextBuffer *buffer = NULL;
 
-   time_str = eail_item_get_text(text, 0, -1);
+   buffer = _eail_item_get_text_buffer(EAIL_ITEM(text));
+   if (!buffer) return '\0';
 
-   if (time_str)
-     {
-         character = g_utf8_get_char
-                              (g_utf8_offset_to_pointer(time_str, offset));
-         g_free(time_str);
-     }
-
-   return character;
+   return eail_text_buffer_get_char(buffer, offset);
 }
 
 /**
@@ -732,18 +1015,121 @@ eail_item_get_character_at_offset(AtkText *text, gint offset)
 static gint
 eail_item_get_character_count(AtkText *text)
 {
-   gint count = 0;
-   gchar* str = NULL;
+   EailTextBuffer *buffer = NULL;
 
-   str = eail_item_get_text(text, 0, -1);
+   buffer = _eail_item_get_text_buffer(EAIL_ITEM(text));
+   if (!buffer) return 0;
 
-   if (str)
-      {
-         count = g_utf8_strlen(str, -1);
-         g_free(str);
-      }
+   return buffer->length;
+}
 
-   return count;
+/**
+ * @brief Gets text delimited by boundary type near offset
+ *
+ * @param text an AtkText
+ * @param boundary_type an AtkTextBoundary
+ * @param offset position
+ * @param relation position of returned text relative to offset
+ * @param [out] start_offset start offset of returned text
+ * @param [out] end_offset end offset of returned text
+ *
+ * @returns newly allocated string, NULL if item has no text
+ */
+static gchar *
+_eail_item_get_text_by_boundary(AtkText *text,
+                                AtkTextBoundary boundary_type,
+                                gint offset,
+                                EailTextRelation relation,
+                                gint *start_offset,
+                                gint *end_offset)
+{
+   EailTextBuffer *buffer = NULL;
+
+   buffer = _eail_item_get_text_buffer(EAIL_ITEM(text));
+   if (!buffer)
+     {
+        *start_offset = *end_offset = 0;
+        return NULL;
+     }
+
+   return eail_text_buffer_get_text_by_boundary(buffer, boundary_type,
+                                                offset, relation,
+                                                start_offset, end_offset);
+}
+
+/**
+ * @brief Gets the specified text at offset
+ *
+ * Implementation of AtkTextIface->get_text_at_offset callback
+ *
+ * @param text an AtkText
+ * @param offset position
+ * @param boundary_type an AtkTextBoundary
+ * @param [out] start_offset start offset of returned text
+ * @param [out] end_offset end offset of returned text
+ *
+ * @returns newly allocated string. Use g_free() to free it.
+ */
+static gchar *
+eail_item_get_text_at_offset(AtkText *text,
+                             gint offset,
+                             AtkTextBoundary boundary_type,
+                             gint *start_offset,
+                             gint *end_offset)
+{
+   return _eail_item_get_text_by_boundary(text, boundary_type, offset,
+                                          EAIL_TEXT_AT_OFFSET,
+                                          start_offset, end_offset);
+}
+
+/**
+ * @brief Gets the specified text before offset
+ *
+ * Implementation of AtkTextIface->get_text_before_offset callback
+ *
+ * @param text an AtkText
+ * @param offset position
+ * @param boundary_type an AtkTextBoundary
+ * @param [out] start_offset start offset of returned text
+ * @param [out] end_offset end offset of returned text
+ *
+ * @returns newly allocated string. Use g_free() to free it.
+ */
+static gchar *
+eail_item_get_text_before_offset(AtkText *text,
+                                 gint offset,
+                                 AtkTextBoundary boundary_type,
+                                 gint *start_offset,
+                                 gint *end_offset)
+{
+   return _eail_item_get_text_by_boundary(text, boundary_type, offset,
+                                          EAIL_TEXT_BEFORE_OFFSET,
+                                          start_offset, end_offset);
+}
+
+/**
+ * @brief Gets the specified text after offset
+ *
+ * Implementation of AtkTextIface->get_text_after_offset callback
+ *
+ * @param text an AtkText
+ * @param offset position
+ * @param boundary_type an AtkTextBoundary
+ * @param [out] start_offset start offset of returned text
+ * @param [out] end_offset end offset of returned text
+ *
+ * @returns newly allocated string. Use g_free() to free it.
+ */
+static gchar *
+eail_item_get_text_after_offset(AtkText *text,
+                                gint offset,
+                                AtkTextBoundary boundary_type,
+                                gint *start_offset,
+                                gint *end_offset)
+{
+   return _eail_item_get_text_by_boundary(text, boundary_type, offset,
+                                          EAIL_TEXT_AFTER_OFFSET,
+                                          start_offset, end_offset);
 }
 
 static void
@@ -752,4 +1138,7 @@ atk_text_interface_init(AtkTextIface *iface)
    iface->get_text = eail_item_get_text;
    iface->get_character_at_offset = eail_item_get_character_at_offset;
    iface->get_character_count = eail_item_get_character_count;
+   iface->get_text_at_offset = eail_item_get_text_at_offset;
+   iface->get_text_before_offset = eail_item_get_text_before_offset;
+   iface->get_text_after_offset = eail_item_get_text_after_offset;
 }
@@ -27,6 +27,8 @@
 #include <atk/atk.h>
 #include <Elementary.h>
 
+#include "eail_text_buffer.h"
+
 #define EAIL_TYPE_ITEM            (eail_item_get_type())
 #define EAIL_ITEM(obj)            (G_TYPE_CHECK_INSTANCE_CAST((obj), \
                                    EAIL_TYPE_ITEM, EailItem))
@@ -51,6 +53,8 @@ struct _EailItem
    AtkObject parent;
 
    Elm_Object_Item *item;
+   EailTextBuffer *buffer;/*!< text of item last fetched, NULL if none */
+   Eina_Array *parts;/*!< cached content parts, NULL if not fetched */
 };
 
 struct _EailItemClass
@@ -61,6 +65,9 @@ struct _EailItemClass
 GType eail_item_get_type(void);
 AtkObject *eail_item_new(AtkObject *parent, AtkRole role);
 Elm_Object_Item *eail_item_get_item(EailItem *item);
+void eail_item_invalidate_text(EailItem *item);
+void eail_item_invalidate_view(EailItem *item);
+void eail_item_invalidate_item(EailItem *item);
 
 #ifdef __cplusplus
 }
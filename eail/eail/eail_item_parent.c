@@ -24,6 +24,37 @@
 */
 
 #include "eail_item_parent.h"
+#include "eail_factory.h"
+#include "eail_utils.h"
+
+/**
+ * @brief Pooled accessible of single Elm_Object_Item
+ */
+typedef struct _EailItemRecord EailItemRecord;
+
+struct _EailItemRecord
+{
+   Elm_Object_Item *item;/*!< item represented by accessible */
+   AtkObject *accessible;/*!< weak reference to EailItem */
+   Evas_Object *container;/*!< widget holding item */
+};
+
+/**
+ * @brief Smart signals emitted by item containers when item view is
+ * (re)created, e.g. after elm_genlist_item_update
+ */
+#define EAIL_ITEM_REALIZED_NAME "realized"
+#define EAIL_ITEM_UNREALIZED_NAME "unrealized"
+
+/**
+ * @brief Elm_Object_Item* to EailItemRecord* of all live item accessibles
+ */
+static Eina_Hash *_eail_item_records = NULL;
+
+/**
+ * @brief Evas_Object* of item container to number of its pooled items
+ */
+static Eina_Hash *_eail_item_containers = NULL;
 
 /**
  *
@@ -261,3 +292,390 @@ eail_item_parent_is_is_content_get_supported(EailItemParent *parent,
 
    return TRUE;
 }
+
+/**
+ * Items are looked up by parent if it implements ref_item_at_point,
+ * otherwise extents of all children are checked.
+ *
+ * @param parent object that holds EailItem in its content
+ * @param x x coordinate
+ * @param y y coordinate
+ * @param coord_type specifies whether the coordinates are relative to the
+ * screen or to the components top level window
+ *
+ * @returns AtkObject* placed at given point or NULL if there is none.
+ * Returned reference should be released with g_object_unref
+ */
+AtkObject *
+eail_item_parent_ref_item_at_point(EailItemParent   *parent,
+                                   gint              x,
+                                   gint              y,
+                                   AtkCoordType      coord_type)
+{
+   EailItemParentIface *iface;
+   AtkObject *child;
+   gint i, n;
+
+   g_return_val_if_fail(EAIL_IS_ITEM_PARENT(parent), NULL);
+
+   iface = EAIL_ITEM_PARENT_GET_IFACE(parent);
+
+   if (iface->ref_item_at_point)
+     return iface->ref_item_at_point(parent, x, y, coord_type);
+
+   n = atk_object_get_n_children(ATK_OBJECT(parent));
+   for (i = 0; i < n; ++i)
+     {
+        child = atk_object_ref_accessible_child(ATK_OBJECT(parent), i);
+        if (!child) continue;
+
+        if (ATK_IS_COMPONENT(child) &&
+            atk_component_contains(ATK_COMPONENT(child), x, y, coord_type))
+          return child;
+
+        g_object_unref(child);
+     }
+
+   return NULL;
+}
+
+/**
+ * Called when item that has pooled EailItem or is watched with
+ * eail_item_parent_watch_item is deleted, so parent can drop its references
+ * to item. Item is being freed, so only its address may be
+ * used.
+ *
+ * @param parent object that holds EailItem in its content
+ * @param item deleted Elm_Object_Item
+ */
+void
+eail_item_parent_item_deleted(EailItemParent   *parent,
+                              Elm_Object_Item  *item)
+{
+   EailItemParentIface *iface;
+
+   g_return_if_fail(EAIL_IS_ITEM_PARENT(parent));
+
+   iface = EAIL_ITEM_PARENT_GET_IFACE(parent);
+
+   if (iface->item_deleted)
+     iface->item_deleted(parent, item);
+}
+
+/**
+ * @brief Callback for item (un)realization, drops cached text and content
+ * parts of pooled accessible of item
+ *
+ * @param data not used
+ * @param obj item container
+ * @param event_info Elm_Object_Item which was (un)realized
+ */
+static void
+_eail_item_parent_on_item_realized(void *data,
+                                   Evas_Object *obj,
+                                   void *event_info)
+{
+   EailItemRecord *record;
+
+   record = eina_hash_find(_eail_item_records, &event_info);
+   if (record)
+     eail_item_invalidate_view(EAIL_ITEM(record->accessible));
+}
+
+/**
+ * @brief Callback for deletion of item container, its items are deleted
+ * right after
+ *
+ * @param data not used
+ * @param e an Evas
+ * @param obj deleted item container
+ * @param event_info additional event info (not used here)
+ */
+static void
+_eail_item_parent_on_container_del(void *data,
+                                   Evas *e,
+                                   Evas_Object *obj,
+                                   void *event_info)
+{
+   eina_hash_del_by_key(_eail_item_containers, &obj);
+}
+
+/**
+ * @brief Counts pooled item of container, starting to track container
+ * signals for its first item
+ *
+ * @param container item container
+ */
+static void
+_eail_item_parent_container_ref(Evas_Object *container)
+{
+   unsigned int n;
+
+   if (!_eail_item_containers)
+     _eail_item_containers = eina_hash_pointer_new(NULL);
+
+   n = GPOINTER_TO_UINT(eina_hash_find(_eail_item_containers, &container));
+   if (!n)
+     {
+        evas_object_smart_callback_add(container, EAIL_ITEM_REALIZED_NAME,
+                                       _eail_item_parent_on_item_realized,
+                                       NULL);
+        evas_object_smart_callback_add(container, EAIL_ITEM_UNREALIZED_NAME,
+                                       _eail_item_parent_on_item_realized,
+                                       NULL);
+        evas_object_event_callback_add(container, EVAS_CALLBACK_DEL,
+                                       _eail_item_parent_on_container_del,
+                                       NULL);
+     }
+
+   eina_hash_set(_eail_item_containers, &container, GUINT_TO_POINTER(n + 1));
+}
+
+/**
+ * @brief Uncounts pooled item of container, stopping to track container
+ * signals with its last item
+ *
+ * @param container item container
+ */
+static void
+_eail_item_parent_container_unref(Evas_Object *container)
+{
+   unsigned int n;
+
+   n = GPOINTER_TO_UINT(eina_hash_find(_eail_item_containers, &container));
+   /* container is already deleted */
+   if (!n) return;
+
+   if (n > 1)
+     {
+        eina_hash_set(_eail_item_containers, &container,
+                      GUINT_TO_POINTER(n - 1));
+        return;
+     }
+
+   evas_object_smart_callback_del_full(container, EAIL_ITEM_REALIZED_NAME,
+                                       _eail_item_parent_on_item_realized,
+                                       NULL);
+   evas_object_smart_callback_del_full(container, EAIL_ITEM_UNREALIZED_NAME,
+                                       _eail_item_parent_on_item_realized,
+                                       NULL);
+   evas_object_event_callback_del_full(container, EVAS_CALLBACK_DEL,
+                                       _eail_item_parent_on_container_del,
+                                       NULL);
+   eina_hash_del_by_key(_eail_item_containers, &container);
+}
+
+/**
+ * @brief Removes record from pool
+ *
+ * @param record an EailItemRecord
+ */
+static void
+_eail_item_parent_record_remove(EailItemRecord *record)
+{
+   Elm_Object_Item *item = record->item;
+
+   if (record->container)
+     _eail_item_parent_container_unref(record->container);
+   eina_hash_del_by_key(_eail_item_records, &item);
+}
+
+/**
+ * @brief Removes record from pool when its accessible is destroyed
+ *
+ * @param data an EailItemRecord
+ * @param where_the_object_was destroyed EailItem
+ */
+static void
+_eail_item_parent_on_accessible_finalized(gpointer data,
+                                          GObject *where_the_object_was)
+{
+   _eail_item_parent_record_remove(data);
+}
+
+/**
+ * @brief Removes record from pool when its item is deleted
+ *
+ * Accessible that is still referenced stops pointing to deleted item. Its
+ * parent and accessible of item widget are notified, so they can drop
+ * references to item also when it has no accessible.
+ *
+ * @param item deleted Elm_Object_Item
+ * @param widget widget holding deleted item
+ */
+static void
+_eail_item_parent_on_item_del(Elm_Object_Item *item, Evas_Object *widget)
+{
+   EailItemRecord *record = NULL;
+   AtkObject *parent = NULL;
+   AtkObject *container = NULL;
+
+   if (_eail_item_records)
+     record = eina_hash_find(_eail_item_records, &item);
+   if (record)
+     {
+        parent = atk_object_get_parent(record->accessible);
+
+        g_object_weak_unref(G_OBJECT(record->accessible),
+                            _eail_item_parent_on_accessible_finalized,
+                            record);
+        eail_item_invalidate_item(EAIL_ITEM(record->accessible));
+        if (record->container)
+          _eail_item_parent_container_unref(record->container);
+        eina_hash_del_by_key(_eail_item_records, &item);
+     }
+
+   if (EAIL_IS_ITEM_PARENT(parent))
+     eail_item_parent_item_deleted(EAIL_ITEM_PARENT(parent), item);
+
+   if (widget)
+     container = eail_factory_find_accessible(widget);
+   if (container != parent && EAIL_IS_ITEM_PARENT(container))
+     eail_item_parent_item_deleted(EAIL_ITEM_PARENT(container), item);
+}
+
+/**
+ * Parents keeping pointers to items which have no accessible use it to learn
+ * about deletion of the items. Watching item again is cheap.
+ *
+ * @param item an Elm_Object_Item
+ */
+void
+eail_item_parent_watch_item(Elm_Object_Item *item)
+{
+   eail_item_del_watch(item, _eail_item_parent_on_item_del);
+}
+
+/**
+ * @brief Drops record from pool without touching its accessible
+ *
+ * @param record an EailItemRecord
+ */
+static void
+_eail_item_parent_record_drop(EailItemRecord *record)
+{
+   g_object_weak_unref(G_OBJECT(record->accessible),
+                       _eail_item_parent_on_accessible_finalized, record);
+   _eail_item_parent_record_remove(record);
+}
+
+/**
+ * @brief Gets accessible representing given item
+ *
+ * Accessibles are pooled as long as anything holds reference to them and
+ * their item is alive, so the same item is always represented by the same
+ * EailItem. Pooled accessible is dropped from pool when its item is deleted,
+ * which is tracked with eail_item_parent_watch_item, also for items without
+ * view. Realization signals are tracked once per item container, and drop
+ * cached text and parts of pooled accessibles.
+ *
+ * @param parent object that holds EailItem in its content
+ * @param item an Elm_Object_Item
+ * @param type GType of newly created accessible, EAIL_TYPE_ITEM or derived
+ * @param role AtkRole used for newly created accessible
+ *
+ * @returns EailItem representing item, should be released with g_object_unref
+ */
+AtkObject *
+eail_item_parent_ref_item_accessible_full(EailItemParent   *parent,
+                                          Elm_Object_Item  *item,
+                                          GType             type,
+                                          AtkRole           role)
+{
+   EailItemRecord *record;
+
+   g_return_val_if_fail(EAIL_IS_ITEM_PARENT(parent), NULL);
+   g_return_val_if_fail(g_type_is_a(type, EAIL_TYPE_ITEM), NULL);
+   g_return_val_if_fail(item, NULL);
+
+   if (!_eail_item_records)
+     _eail_item_records = eina_hash_pointer_new(free);
+
+   record = eina_hash_find(_eail_item_records, &item);
+   if (record &&
+       (atk_object_get_parent(record->accessible) != ATK_OBJECT(parent) ||
+        G_OBJECT_TYPE(record->accessible) != type))
+     {
+        /* old accessible may outlive its record, so it must not keep item */
+        eail_item_invalidate_item(EAIL_ITEM(record->accessible));
+        _eail_item_parent_record_drop(record);
+        record = NULL;
+     }
+
+   if (record)
+     return g_object_ref(record->accessible);
+
+   record = calloc(1, sizeof(EailItemRecord));
+   if (!record) return NULL;
+
+   record->item = item;
+   record->container = elm_object_item_widget_get(item);
+   record->accessible = g_object_new(type, NULL);
+   record->accessible->role = role;
+   atk_object_set_parent(record->accessible, ATK_OBJECT(parent));
+   atk_object_initialize(record->accessible, item);
+
+   eina_hash_add(_eail_item_records, &item, record);
+   g_object_weak_ref(G_OBJECT(record->accessible),
+                     _eail_item_parent_on_accessible_finalized, record);
+   eail_item_parent_watch_item(item);
+   if (record->container)
+     _eail_item_parent_container_ref(record->container);
+
+   return record->accessible;
+}
+
+/**
+ * @brief Gets accessible representing given item
+ *
+ * Works as eail_item_parent_ref_item_accessible_full for plain EailItem.
+ *
+ * @param parent object that holds EailItem in its content
+ * @param item an Elm_Object_Item
+ * @param role AtkRole used for newly created EailItem
+ *
+ * @returns EailItem representing item, should be released with g_object_unref
+ */
+AtkObject *
+eail_item_parent_ref_item_accessible(EailItemParent   *parent,
+                                     Elm_Object_Item  *item,
+                                     AtkRole           role)
+{
+   return eail_item_parent_ref_item_accessible_full(parent, item,
+                                                    EAIL_TYPE_ITEM, role);
+}
+
+/**
+ * @brief Collects pooled records, called for each record on shutdown
+ */
+static Eina_Bool
+_eail_item_parent_record_drop_cb(const Eina_Hash *hash, const void *key,
+                                 void *data, void *fdata)
+{
+   *(Eina_List **)fdata = eina_list_append(*(Eina_List **)fdata, data);
+
+   return EINA_TRUE;
+}
+
+/**
+ * @brief Drops all pooled item accessibles and stops tracking their items
+ */
+void
+eail_item_parent_pool_shutdown(void)
+{
+   Eina_List *records = NULL;
+   EailItemRecord *record;
+
+   if (!_eail_item_records) return;
+
+   /* records can not be removed while iterating over hash */
+   eina_hash_foreach(_eail_item_records, _eail_item_parent_record_drop_cb,
+                     &records);
+   EINA_LIST_FREE(records, record)
+     _eail_item_parent_record_drop(record);
+
+   eina_hash_free(_eail_item_records);
+   _eail_item_records = NULL;
+   eina_hash_free(_eail_item_containers);
+   _eail_item_containers = NULL;
+}
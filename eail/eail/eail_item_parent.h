@@ -76,6 +76,14 @@ struct _EailItemParentIface
 
    gboolean    (*is_content_get_supported) (EailItemParent   *parent,
                                             EailItem         *item);
+
+   AtkObject * (*ref_item_at_point)        (EailItemParent   *parent,
+                                            gint              x,
+                                            gint              y,
+                                            AtkCoordType      coord_type);
+
+   void        (*item_deleted)             (EailItemParent   *parent,
+                                            Elm_Object_Item  *item);
 };
 
 /** @brief Initializer for EailParentInterface */
@@ -143,6 +151,48 @@ gboolean eail_item_parent_is_is_content_get_supported(EailItemParent   *parent,
 Evas_Object * eail_item_parent_get_evas_obj (EailItemParent   *parent,
                                              EailItem         *item);
 
+/**
+ * @brief Gets reference to EailItem placed at given point
+ */
+AtkObject * eail_item_parent_ref_item_at_point (EailItemParent   *parent,
+                                                gint              x,
+                                                gint              y,
+                                                AtkCoordType      coord_type);
+
+/**
+ * @brief Notifies parent that item represented by its EailItem or watched
+ * item is deleted
+ */
+void        eail_item_parent_item_deleted  (EailItemParent   *parent,
+                                            Elm_Object_Item  *item);
+
+/**
+ * @brief Notifies parent of item about its deletion
+ */
+void        eail_item_parent_watch_item    (Elm_Object_Item  *item);
+
+/**
+ * @brief Gets reference to pooled EailItem representing given item
+ */
+AtkObject * eail_item_parent_ref_item_accessible(EailItemParent   *parent,
+                                                 Elm_Object_Item  *item,
+                                                 AtkRole           role);
+
+/**
+ * @brief Gets reference to pooled accessible of given type representing
+ * given item
+ */
+AtkObject * eail_item_parent_ref_item_accessible_full
+                                            (EailItemParent   *parent,
+                                             Elm_Object_Item  *item,
+                                             GType             type,
+                                             AtkRole           role);
+
+/**
+ * @brief Drops all pooled item accessibles
+ */
+void    eail_item_parent_pool_shutdown      (void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -48,6 +48,26 @@ eail_label_initialize(AtkObject *obj, gpointer data)
    obj->role = ATK_ROLE_LABEL;
 }
 
+/**
+ * @brief Gets textblock of label
+ *
+ * @param text an EailText
+ * @return textblock part of label theme, NULL if there is none
+ */
+static Evas_Object *
+eail_label_get_textblock(EailText *text)
+{
+   Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(text));
+   Evas_Object *edje;
+
+   if (!widget) return NULL;
+
+   edje = elm_layout_edje_get(widget);
+   if (!edje) return NULL;
+
+   return (Evas_Object *)edje_object_part_object_get(edje, "elm.text");
+}
+
 /**
  * @brief EailLabel interface intializer.
  *
@@ -70,6 +90,7 @@ eail_label_class_init(EailLabelClass *klass)
 
    class->initialize = eail_label_initialize;
    class->ref_state_set = eail_label_ref_state_set;
+   EAIL_TEXT_CLASS(klass)->get_textblock = eail_label_get_textblock;
 }
 
 /**
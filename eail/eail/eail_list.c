@@ -46,39 +46,135 @@ G_DEFINE_TYPE_WITH_CODE(EailList,
                         G_IMPLEMENT_INTERFACE(ATK_TYPE_SELECTION,
                                               atk_selection_interface_init))
 
+#define EAIL_LIST_SELECTED_NAME "selected"
+#define EAIL_LIST_UNSELECTED_NAME "unselected"
+
 /**
- * @brief Initializer for AtkObjectClass
+ * @brief Drops index of selected items
+ *
+ * Index will be built again on next request
+ *
+ * @param list an EailList
  */
 static void
-eail_list_initialize(AtkObject *obj, gpointer data)
+eail_list_selection_invalidate(EailList *list)
 {
-   ATK_OBJECT_CLASS(eail_list_parent_class)->initialize(obj, data);
+   if (list->selected)
+     {
+        eina_array_free(list->selected);
+        list->selected = NULL;
+     }
+}
 
-   obj->role = ATK_ROLE_LIST;
+/**
+ * @brief Drops items map, it will be filled again on next request
+ *
+ * @param list an EailList
+ */
+static void
+eail_list_items_invalidate(EailList *list)
+{
+   eail_list_selection_invalidate(list);
+   eina_array_clean(list->items);
+   eina_hash_free_buckets(list->items_index);
+   list->items_list = NULL;
+   list->items_count = 0;
 }
 
 /**
- * @brief Prepares Eina_List filled with Elm_Object_Item* objects
- * representing items in the list
+ * @brief Gets index to item map, filling it again if list items changed
  *
- * @return filled list with list items. Call eina_list_free on that list when
- * results processing has been finished
+ * Items are appended, prepended and inserted by replacing the items list, or
+ * at least changing its length, which is cheap to check on every request.
+ * Mapped items are watched and map is dropped whenever any of them is
+ * deleted, see eail_list_item_deleted, so it never holds deleted items.
+ *
+ * @param list an EailList
+ * @return Eina_Array of Elm_Object_Item* owned by list or NULL if widget is
+ * not available
  */
-static Eina_List *
+static Eina_Array *
 eail_list_get_items(EailList *list)
 {
-   Eina_List *items = NULL;
-   Elm_Object_Item *item;
    Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(list));
+   const Eina_List *items, *l;
+   Elm_Object_Item *item;
+
+   if (!widget) return NULL;
+
+   items = elm_list_items_get(widget);
+   if (items == list->items_list &&
+       eina_list_count(items) == list->items_count &&
+       (!items || eina_list_last(items)->data ==
+        eina_array_data_get(list->items, list->items_count - 1)))
+     return list->items;
+
+   eail_list_items_invalidate(list);
 
-   item = elm_list_first_item_get(widget);
-   while (item)
+   EINA_LIST_FOREACH(items, l, item)
      {
-        items = eina_list_append(items, item);
-        item = elm_list_item_next(item);
+        eina_array_push(list->items, item);
+        eina_hash_add(list->items_index, &item,
+                      GUINT_TO_POINTER(eina_array_count(list->items)));
+        eail_item_parent_watch_item(item);
      }
 
-   return items;
+   list->items_list = items;
+   list->items_count = eina_array_count(list->items);
+
+   return list->items;
+}
+
+/**
+ * @brief Gets item with given index
+ *
+ * @param list an EailList
+ * @param i index of item
+ * @return item or NULL if there is no item with given index
+ */
+static Elm_Object_Item *
+eail_list_item_nth(EailList *list, gint i)
+{
+   Eina_Array *items = eail_list_get_items(list);
+
+   if (!items || i < 0 || (unsigned int)i >= eina_array_count(items))
+     return NULL;
+
+   return eina_array_data_get(items, i);
+}
+
+/**
+ * @brief Callback used to drop index of selected items when selection changes
+ *
+ * @param data an EailList
+ * @param obj list Evas_Object
+ * @param event_info selected or unselected Elm_Object_Item
+ */
+static void
+eail_list_on_selection_changed(void *data, Evas_Object *obj, void *event_info)
+{
+   eail_list_selection_invalidate(EAIL_LIST(data));
+}
+
+/**
+ * @brief Initializer for AtkObjectClass
+ */
+static void
+eail_list_initialize(AtkObject *obj, gpointer data)
+{
+   Evas_Object *widget;
+
+   ATK_OBJECT_CLASS(eail_list_parent_class)->initialize(obj, data);
+
+   obj->role = ATK_ROLE_LIST;
+
+   widget = eail_widget_get_widget(EAIL_WIDGET(obj));
+   if (!widget) return;
+
+   evas_object_smart_callback_add(widget, EAIL_LIST_SELECTED_NAME,
+                                  eail_list_on_selection_changed, obj);
+   evas_object_smart_callback_add(widget, EAIL_LIST_UNSELECTED_NAME,
+                                  eail_list_on_selection_changed, obj);
 }
 
 /**
@@ -95,15 +191,11 @@ eail_list_get_items(EailList *list)
 static gint
 eail_list_get_n_children(AtkObject *obj)
 {
-   gint n_items;
-   Eina_List *items;
-
-   items = eail_list_get_items(EAIL_LIST(obj));
-   n_items = eina_list_count(items);
+   Eina_Array *items = eail_list_get_items(EAIL_LIST(obj));
 
-   eina_list_free(items);
+   if (!items) return 0;
 
-   return n_items;
+   return eina_array_count(items);
 }
 
 /**
@@ -120,20 +212,16 @@ eail_list_get_n_children(AtkObject *obj)
 static AtkObject *
 eail_list_ref_child(AtkObject *obj, gint i)
 {
-   Eina_List *items;
+   Elm_Object_Item *item;
    AtkObject *child = NULL;
 
-   items = eail_list_get_items(EAIL_LIST(obj));
-   if (eina_list_count(items) > i)
+   item = eail_list_item_nth(EAIL_LIST(obj), i);
+   if (item)
      {
-        child = eail_item_new(obj, ATK_ROLE_LIST_ITEM);
-        atk_object_initialize(child, eina_list_nth(items, i));
-
-        g_object_ref(child);
+        child = eail_item_parent_ref_item_accessible
+           (EAIL_ITEM_PARENT(obj), item, ATK_ROLE_LIST_ITEM);
      }
 
-   eina_list_free(items);
-
    return child;
 }
 
@@ -169,6 +257,26 @@ eail_list_ref_state_set(AtkObject *obj)
 static void
 eail_list_init(EailList *list)
 {
+   list->items = eina_array_new(32);
+   list->items_index = eina_hash_pointer_new(NULL);
+   list->items_list = NULL;
+   list->items_count = 0;
+   list->selected = NULL;
+}
+
+/**
+ * @brief Finalize function for GObject
+ */
+static void
+eail_list_finalize(GObject *object)
+{
+   EailList *list = EAIL_LIST(object);
+
+   eail_list_selection_invalidate(list);
+   eina_hash_free(list->items_index);
+   eina_array_free(list->items);
+
+   G_OBJECT_CLASS(eail_list_parent_class)->finalize(object);
 }
 
 /**
@@ -178,6 +286,9 @@ static void
 eail_list_class_init(EailListClass *klass)
 {
    AtkObjectClass *class = ATK_OBJECT_CLASS(klass);
+   GObjectClass *gobject_class = G_OBJECT_CLASS(klass);
+
+   gobject_class->finalize = eail_list_finalize;
 
    class->initialize = eail_list_initialize;
    class->get_n_children = eail_list_get_n_children;
@@ -293,6 +404,40 @@ eail_list_item_name_get(EailItemParent *parent, EailItem *item)
    return elm_object_item_part_text_get(it, NULL);
 }
 
+/**
+ * @brief Implementation of EailItemParent->item_deleted callback
+ *
+ * @param parent EailList instance
+ * @param item deleted list item
+ */
+static void
+eail_list_item_deleted(EailItemParent *parent, Elm_Object_Item *item)
+{
+   EailList *list = EAIL_LIST(parent);
+
+   if (eina_hash_find(list->items_index, &item))
+     eail_list_items_invalidate(list);
+}
+
+/**
+ * @brief Implementation of EailItemParent->get_item_index_in_parent callback
+ *
+ * @param parent EailList instance
+ * @param item EailList child instance
+ *
+ * @returns index of item in list or -1 if item was not found
+ */
+static gint
+eail_list_get_item_index_in_parent(EailItemParent *parent, EailItem *item)
+{
+   EailList *list = EAIL_LIST(parent);
+   Elm_Object_Item *it = eail_item_get_item(item);
+
+   if (!it || !eail_list_get_items(list)) return -1;
+
+   return GPOINTER_TO_INT(eina_hash_find(list->items_index, &it)) - 1;
+}
+
 /**
  * @brief Initialization of EailItemParentIface callbacks
  */
@@ -301,16 +446,76 @@ eail_item_parent_interface_init(EailItemParentIface *iface)
 {
    iface->get_item_name            = eail_list_item_name_get;
    iface->get_item_role            = eail_list_get_item_role;
+   iface->get_item_index_in_parent = eail_list_get_item_index_in_parent;
    iface->ref_item_state_set       = eail_list_ref_item_state_set;
    iface->grab_item_focus          = eail_list_grab_item_focus;
    iface->get_evas_obj             = eail_list_get_evas_obj;
    iface->is_click_supported       = eail_list_is_item_click_supported;
+   iface->item_deleted             = eail_list_item_deleted;
 }
 
 /*
  * Functions for the *AtkSelection* interface
  */
 
+/**
+ * @brief Compares items by their index in list
+ *
+ * @param a pointer to Elm_Object_Item*
+ * @param b pointer to Elm_Object_Item*
+ * @param data an EailList
+ * @returns negative, zero or positive value if a goes before, together with
+ * or after b
+ */
+static gint
+eail_list_item_compare(gconstpointer a, gconstpointer b, gpointer data)
+{
+   EailList *list = data;
+
+   return GPOINTER_TO_INT(eina_hash_find(list->items_index, a)) -
+          GPOINTER_TO_INT(eina_hash_find(list->items_index, b));
+}
+
+/**
+ * @brief Gets selected items in child order
+ *
+ * Index is built once per selection change from selected items reported by
+ * list, so it costs O(k log k) for k selected items and is reused by
+ * subsequent requests.
+ *
+ * @param list an EailList
+ * @returns Eina_Array of selected Elm_Object_Item* owned by list, NULL if
+ * widget is not available
+ */
+static Eina_Array *
+eail_list_get_selected(EailList *list)
+{
+   Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(list));
+   const Eina_List *l;
+   Elm_Object_Item *item;
+   GPtrArray *sorted;
+   guint i;
+
+   /* fills index to item map, dropping selection index if items changed */
+   if (!eail_list_get_items(list)) return NULL;
+   if (list->selected) return list->selected;
+
+   sorted = g_ptr_array_new();
+   EINA_LIST_FOREACH(elm_list_selected_items_get(widget), l, item)
+     {
+        if (eina_hash_find(list->items_index, &item))
+          g_ptr_array_add(sorted, item);
+     }
+   g_ptr_array_sort_with_data(sorted, eail_list_item_compare, list);
+
+   list->selected = eina_array_new(MAX(sorted->len, 1));
+   for (i = 0; i < sorted->len; ++i)
+     eina_array_push(list->selected, g_ptr_array_index(sorted, i));
+   g_ptr_array_free(sorted, TRUE);
+
+   return list->selected;
+}
+
 /**
  * @brief Implementation of AtkSelection->add_selection callback
  *
@@ -327,9 +532,7 @@ eail_list_add_selection(AtkSelection *selection,
                         gint i)
 {
    g_return_val_if_fail(EAIL_IS_WIDGET(selection), FALSE);
-   Evas_Object *object = eail_widget_get_widget(EAIL_WIDGET(selection));
-   const Eina_List *items = elm_list_items_get(object);
-   Elm_Object_Item *item = eina_list_nth(items, i);
+   Elm_Object_Item *item = eail_list_item_nth(EAIL_LIST(selection), i);
 
    if (!item) return FALSE;
 
@@ -357,9 +560,20 @@ static AtkObject *
 eail_list_ref_selection(AtkSelection *selection,
                         gint i)
 {
+   Eina_Array *selected;
+   AtkObject *child;
+
    g_return_val_if_fail(EAIL_IS_WIDGET(selection), NULL);
 
-   return eail_list_ref_child(ATK_OBJECT(selection), i);
+   selected = eail_list_get_selected(EAIL_LIST(selection));
+   if (!selected || i < 0 || (unsigned int)i >= eina_array_count(selected))
+     return NULL;
+
+   child = eail_item_parent_ref_item_accessible
+      (EAIL_ITEM_PARENT(selection), eina_array_data_get(selected, i),
+       ATK_ROLE_LIST_ITEM);
+
+   return child;
 }
 
 /**
@@ -406,26 +620,14 @@ static gboolean
 eail_list_is_child_selected(AtkSelection *selection,
                             gint i)
 {
-   g_return_val_if_fail(EAIL_IS_WIDGET(selection), FALSE);
-   Evas_Object *object = eail_widget_get_widget(EAIL_WIDGET(selection));
-   Elm_Object_Item *selected_item = elm_list_selected_item_get(object);
-   Elm_Object_Item *last_item = elm_list_last_item_get(object);
-   Elm_Object_Item *item = elm_list_first_item_get(object);
-   gint n = 0;
-
-   /* if there is no selected object, that naturally means that none
-    * of children is selected */
-   if (!selected_item) return FALSE;
+   Elm_Object_Item *item;
 
-   do
-     {
-        if (selected_item == item) break;
+   g_return_val_if_fail(EAIL_IS_WIDGET(selection), FALSE);
 
-        item = elm_list_item_next(item);
-        n++;
-     } while (item != last_item);
+   item = eail_list_item_nth(EAIL_LIST(selection), i);
+   if (!item) return FALSE;
 
-   return i == n;
+   return elm_list_item_selected_get(item);
 }
 
 /**
@@ -440,7 +642,6 @@ static gboolean
 eail_list_remove_selection(AtkSelection *selection,
                            gint i)
 {
-   const Eina_List *items = NULL;
    Evas_Object *object = NULL;
    Elm_Object_Item *item = NULL;
 
@@ -448,10 +649,9 @@ eail_list_remove_selection(AtkSelection *selection,
    object = eail_widget_get_widget(EAIL_WIDGET(selection));
    g_return_val_if_fail(object, FALSE);
 
-   items = elm_list_items_get(object);
-   g_return_val_if_fail((eina_list_count(items) > i), FALSE);
+   item = eail_list_item_nth(EAIL_LIST(selection), i);
+   g_return_val_if_fail(item, FALSE);
 
-   item = eina_list_nth(items, i);
    elm_list_item_selected_set(item, EINA_FALSE);
 
    /* if change was successful, then selected item now should be different */
@@ -462,25 +662,61 @@ eail_list_remove_selection(AtkSelection *selection,
  * @brief Helper function that selects/unselects all items in the list depending
  * on "selected" param value
  *
+ * Evas events and edje recalculation are frozen during the sweep, so the
+ * list is laid out once. Only items which change their state are touched:
+ * all items when selecting, only selected ones when clearing. Single
+ * "selection-changed" signal is emitted at the end.
+ *
+ * @param selection an AtkSelection
  * @param object an Evas_Object
  * @param selected selected state (TRUE means selected)
  *
  * @returns TRUE if success, FALSE otherwise.
  */
 static gboolean
-eail_list_mark_all_selected_state(const Evas_Object *object, Eina_Bool selected)
+eail_list_mark_all_selected_state(AtkSelection *selection,
+                                  Evas_Object *object,
+                                  Eina_Bool selected)
 {
-   const Eina_List *items = NULL;
-   int i = 0;
+   const Eina_List *items = NULL, *l;
+   Eina_List *selected_items;
+   Elm_Object_Item *item;
+   Evas *evas;
+   gboolean changed = FALSE;
 
-   items = elm_list_items_get(object);
-   for (i = 0; i < eina_list_count(items); ++i)
-     {
-        Elm_Object_Item *item = eina_list_nth(items, i);
-        if (!item) return FALSE;
+   if (!object) return FALSE;
 
-        elm_list_item_selected_set(item, selected);
+   evas = evas_object_evas_get(object);
+   evas_event_freeze(evas);
+   edje_freeze();
+
+   if (selected)
+     {
+        items = elm_list_items_get(object);
+        EINA_LIST_FOREACH(items, l, item)
+          {
+             if (elm_list_item_selected_get(item)) continue;
+
+             elm_list_item_selected_set(item, EINA_TRUE);
+             changed = TRUE;
+          }
      }
+   else
+     {
+        /* selected items list is modified while unselecting */
+        selected_items = eina_list_clone(elm_list_selected_items_get(object));
+        EINA_LIST_FREE(selected_items, item)
+          {
+             elm_list_item_selected_set(item, EINA_FALSE);
+             changed = TRUE;
+          }
+     }
+
+   edje_thaw();
+   evas_event_thaw(evas);
+
+   if (changed)
+     g_signal_emit_by_name(selection, "selection-changed");
 
    return TRUE;
 }
@@ -503,7 +739,7 @@ eail_list_select_all_selection(AtkSelection *selection)
    /* can select all only when multiselect is enabled */
    if (!elm_list_multi_select_get(object)) return FALSE;
 
-   return eail_list_mark_all_selected_state(object, EINA_TRUE);
+   return eail_list_mark_all_selected_state(selection, object, EINA_TRUE);
 }
 
 /**
@@ -523,7 +759,7 @@ eail_list_clear_selection(AtkSelection *selection)
    g_return_val_if_fail(EAIL_IS_WIDGET(selection), FALSE);
    Evas_Object *object = eail_widget_get_widget(EAIL_WIDGET(selection));
 
-   return eail_list_mark_all_selected_state(object, EINA_FALSE);
+   return eail_list_mark_all_selected_state(selection, object, EINA_FALSE);
 }
 
 /**
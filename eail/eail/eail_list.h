@@ -48,6 +48,13 @@ typedef struct _EailListClass EailListClass;
 struct _EailList
 {
    EailScrollableWidget parent;
+
+   Eina_Array *items;/*!< index to Elm_Object_Item* map */
+   Eina_Hash *items_index;/*!< Elm_Object_Item* to its index + 1 */
+   const Eina_List *items_list;/*!< list items when map was filled */
+   unsigned int items_count;/*!< list items count when map was filled */
+   Eina_Array *selected;/*!< selected items in child order, NULL if not
+                          fetched */
 };
 
 struct _EailListClass
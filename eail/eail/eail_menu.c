@@ -126,10 +126,9 @@ eail_menu_ref_child(AtkObject *obj, gint i)
    items = eail_menu_get_items(EAIL_MENU(obj));
    if (eina_list_count(items) > i)
      {
-        child = eail_menu_item_new(obj);
-        atk_object_initialize(child, eina_list_nth(items, i));
-
-        g_object_ref(child);
+        child = eail_item_parent_ref_item_accessible_full
+           (EAIL_ITEM_PARENT(obj), eina_list_nth(items, i),
+            EAIL_TYPE_MENU_ITEM, ATK_ROLE_MENU_ITEM);
      }
 
    eina_list_free(items);
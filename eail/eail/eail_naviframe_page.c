@@ -200,13 +200,17 @@ static AtkObject *
 eail_naviframe_page_ref_child(AtkObject *obj, gint i)
 {
    EailNaviframePage *page;
+   AtkObject *child;
 
    g_return_val_if_fail(EAIL_IS_NAVIFRAME_PAGE(obj), NULL);
 
    page = EAIL_NAVIFRAME_PAGE(obj);
    if (i >= page->child_count) return NULL;
 
-   return eail_factory_get_accessible(page->content[i]);
+   child = eail_factory_get_accessible(page->content[i]);
+   if (child) g_object_ref(child);
+
+   return child;
 }
 
 /**
@@ -133,6 +133,9 @@ eail_panes_ref_child(AtkObject *obj, int i)
          child = NULL;
          break;
      }
+
+   if (child) g_object_ref(child);
+
    return child;
 }
 
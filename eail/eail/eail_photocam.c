@@ -139,19 +139,6 @@ eail_photocam_initialize(AtkObject *obj, gpointer data)
    ATK_OBJECT_CLASS(eail_photocam_parent_class)->initialize(obj, data);
 
    obj->role = ATK_ROLE_IMAGE;
-
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(obj),
-                                    EAIL_PHOTOCAM_ACTION_ZOOM_IN,
-                                    NULL,
-                                    _eail_photocam_action_zoom_in);
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(obj),
-                                    EAIL_PHOTOCAM_ACTION_ZOOM_OUT,
-                                    NULL,
-                                    _eail_photocam_action_zoom_out);
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(obj),
-                                    EAIL_PHOTOCAM_ACTION_CLICK,
-                                    NULL,
-                                    _eail_photocam_action_click);
 }
 
 /**
@@ -196,6 +183,11 @@ eail_photocam_finalize(GObject *object)
 static void
 eail_photocam_class_init(EailPhotocamClass *klass)
 {
+   static const EailActionDef actions[] = {
+        {EAIL_PHOTOCAM_ACTION_ZOOM_IN, NULL, _eail_photocam_action_zoom_in},
+        {EAIL_PHOTOCAM_ACTION_ZOOM_OUT, NULL, _eail_photocam_action_zoom_out},
+        {EAIL_PHOTOCAM_ACTION_CLICK, NULL, _eail_photocam_action_click}
+   };
    AtkObjectClass *class = ATK_OBJECT_CLASS(klass);
    GObjectClass *g_object_class = G_OBJECT_CLASS(klass);
 
@@ -203,6 +195,10 @@ eail_photocam_class_init(EailPhotocamClass *klass)
    class->ref_state_set = eail_photocam_ref_state_set;
 
    g_object_class->finalize = eail_photocam_finalize;
+
+   /* appended after scroll actions inherited from EailScrollableWidget */
+   eail_action_widget_class_actions_append(EAIL_ACTION_WIDGET_CLASS(klass),
+                                           actions, G_N_ELEMENTS(actions));
 }
 
 /**
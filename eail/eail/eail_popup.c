@@ -62,8 +62,9 @@ eail_popup_initialize(AtkObject *obj, gpointer data)
  * @brief EailPopup GObject instance initializer
  */
 static void
-eail_popup_init(EailPopup *button)
+eail_popup_init(EailPopup *popup)
 {
+   popup->buffer = NULL;
 }
 
 /**
@@ -251,6 +252,8 @@ eail_popup_get_name(AtkObject *obj)
 static void
 eail_popup_finalize(GObject *object)
 {
+   eail_text_buffer_free(EAIL_POPUP(object)->buffer);
+
    G_OBJECT_CLASS(eail_popup_parent_class)->finalize(object);
 }
 
@@ -275,32 +278,30 @@ eail_popup_class_init(EailPopupClass *klass)
  */
 
 /**
- * @brief Helper function that gets text from popup as Eina_Strbuf*
+ * @brief Helper function that gets plain text of popup
+ *
+ * Buffer is converted from popup markup again only if the markup changed.
  *
  * @param popup an EailPopup instance
  *
- * @returns Eina_Strbuf* object with filled text content of a popup
+ * @returns EailTextBuffer* with plain text content of a popup or NULL if
+ * popup has no text
  */
-static Eina_Strbuf *
-_eail_popup_get_strbuf(AtkText *popup)
+static EailTextBuffer *
+_eail_popup_get_buffer(AtkText *popup)
 {
    Evas_Object *popup_widget = NULL;
-   Eina_Strbuf* str_buf = NULL;
-   const gchar *text_part = NULL;
-
-   g_return_val_if_fail (ATK_IS_OBJECT(popup), NULL);
+   EailPopup *eail_popup = EAIL_POPUP(popup);
 
    /* getting widget of popup class */
    popup_widget = _eail_get_popup_widget_from_atkobj(ATK_OBJECT(popup));
    if (!popup_widget) return NULL;
 
-   text_part = elm_object_part_text_get(popup_widget, "default");
-   if (!text_part) return NULL;
+   eail_popup->buffer = eail_text_buffer_update
+                  (eail_popup->buffer,
+                   elm_object_part_text_get(popup_widget, "default"));
 
-   str_buf = eina_strbuf_new();
-   eina_strbuf_append(str_buf, text_part);
-
-   return str_buf;
+   return eail_popup->buffer;
 }
 
 /**
@@ -321,20 +322,14 @@ eail_popup_get_text(AtkText          *popup,
                     gint              start_offset,
                     gint              end_offset)
 {
-   Eina_Strbuf* str_buf = NULL;
-   gchar *ret_str = NULL;
+   EailTextBuffer *buffer = NULL;
 
    g_return_val_if_fail(EAIL_IS_POPUP(popup), NULL);
 
-   str_buf = _eail_popup_get_strbuf(popup);
-   if (!str_buf) return NULL;
-
-   ret_str = eail_get_substring
-               (eina_strbuf_string_get(str_buf), start_offset, end_offset);
-
-   eina_strbuf_free(str_buf);
+   buffer = _eail_popup_get_buffer(popup);
+   if (!buffer) return NULL;
 
-   return ret_str;
+   return eail_text_buffer_get_text(buffer, start_offset, end_offset);
 }
 
 /**
@@ -350,21 +345,14 @@ eail_popup_get_text(AtkText          *popup,
 static gunichar
 eail_popup_get_character_at_offset(AtkText *popup, gint offset)
 {
-   gunichar character = '\0';
-   gchar* time_str = NULL;
+   EailTextBuffer *buffer = NULL;
 
-   g_return_val_if_fail(EAIL_IS_POPUP(popup), character);
+   g_return_val_if_fail(EAIL_IS_POPUP(popup), '\0');
 
-   time_str = eail_popup_get_text(popup, 0, -1);
+   buffer = _eail_popup_get_buffer(popup);
+   if (!buffer) return '\0';
 
-   if (time_str)
-     {
-         character = g_utf8_get_char
-                  (g_utf8_offset_to_pointer(time_str, offset));
-         g_free(time_str);
-     }
-
-   return character;
+   return eail_text_buffer_get_char(buffer, offset);
 }
 
 /**
@@ -378,20 +366,14 @@ eail_popup_get_character_at_offset(AtkText *popup, gint offset)
 static gint
 eail_popup_get_character_count(AtkText *popup)
 {
-   gint count = 0;
-   gchar* time_str = NULL;
+   EailTextBuffer *buffer = NULL;
 
    g_return_val_if_fail(EAIL_IS_POPUP(popup), 0);
 
-   time_str = eail_popup_get_text(popup, 0, -1);
-
-   if (time_str)
-     {
-         count = g_utf8_strlen(time_str, -1);
-         g_free(time_str);
-     }
+   buffer = _eail_popup_get_buffer(popup);
+   if (!buffer) return 0;
 
-   return count;
+   return buffer->length;
 }
 
 /**
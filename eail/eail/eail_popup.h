@@ -21,12 +21,13 @@
 #define EAIL_POPUP_H
 
 #include "eail_notify.h"
+#include "eail_text_buffer.h"
 
 #define EAIL_TYPE_POPUP             (eail_popup_get_type())
-#define EAIL_POPUP(obj)             (G_TYPE_POPUP_INSTANCE_CAST((obj), \
+#define EAIL_POPUP(obj)             (G_TYPE_CHECK_INSTANCE_CAST((obj), \
                                             EAIL_TYPE_POPUP, \
                                             EailPopup))
-#define EAIL_POPUP_CLASS(klass)     (G_TYPE_POPUP_CLASS_CAST((klass), \
+#define EAIL_POPUP_CLASS(klass)     (G_TYPE_CHECK_CLASS_CAST((klass), \
                                             EAIL_TYPE_POPUP, \
                                             EailPopupClass))
 #define EAIL_IS_POPUP(obj)          (G_TYPE_CHECK_INSTANCE_TYPE((obj), \
@@ -47,6 +48,8 @@ typedef struct _EailPopupClass EailPopupClass;
 struct _EailPopup
 {
    EailNotify parent;
+
+   EailTextBuffer *buffer;/*!< cached plain text of popup */
 };
 
 struct _EailPopupClass
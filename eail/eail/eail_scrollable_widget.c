@@ -28,7 +28,8 @@
 #include "eail_scrollable_widget.h"
 #include "eail_priv.h"
 
-static void eail_scrollable_widget_actions_table_init(EailScrollableWidget *widget);
+static void eail_scrollable_widget_actions_table_init
+                                          (EailScrollableWidgetClass *klass);
 
 /**
  * @brief definition of EailScrollableWidget as GObject
@@ -37,8 +38,8 @@ static void eail_scrollable_widget_actions_table_init(EailScrollableWidget *widg
  * all needed functions for ATK_ACTION interface so additional implementing
  * ATK_ACTION interface here is not needed.
  * Only what is really needed, is to call:
- * eail_action_widget_action_append(...) to register all needed additional
- * actions
+ * eail_action_widget_class_actions_append(...) to register all needed
+ * additional actions
  */
 G_DEFINE_TYPE(EailScrollableWidget, eail_scrollable_widget,
               EAIL_TYPE_ACTION_WIDGET);
@@ -63,11 +64,6 @@ static void
 eail_scrollable_widget_initialize(AtkObject *obj, gpointer data)
 {
    ATK_OBJECT_CLASS(eail_scrollable_widget_parent_class)->initialize(obj, data);
-
-   EailScrollableWidget *widget = EAIL_SCROLLABLE_WIDGET(obj);
-
-   /* Initializing possible widget actions table*/
-   eail_scrollable_widget_actions_table_init(widget);
 }
 
 /**
@@ -101,6 +97,9 @@ eail_scrollable_widget_class_init(EailScrollableWidgetClass *klass)
    GObjectClass *gobject_class = G_OBJECT_CLASS(klass);
    class->initialize = eail_scrollable_widget_initialize;
    gobject_class->finalize = eail_scrollable_widget_finalize;
+
+   /* Initializing possible widget actions table*/
+   eail_scrollable_widget_actions_table_init(klass);
 }
 
 /**
@@ -178,21 +177,18 @@ eail_action_scroll_right(AtkAction *action, void *data)
 
 /**
  * @brief Adds actions for scrolling to actions table
- * @param widget widget that implements EailScrollable interface
+ * @param klass EailScrollableWidgetClass
  */
 static void
-eail_scrollable_widget_actions_table_init(EailScrollableWidget *widget)
+eail_scrollable_widget_actions_table_init(EailScrollableWidgetClass *klass)
 {
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(widget),
-                                    EAIL_STR_SCROLL_UP, NULL,
-                                    eail_action_scroll_up);
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(widget),
-                                    EAIL_STR_SCROLL_DOWN, NULL,
-                                    eail_action_scroll_down);
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(widget),
-                                    EAIL_STR_SCROLL_LEFT, NULL,
-                                    eail_action_scroll_left);
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(widget),
-                                    EAIL_STR_SCROLL_RIGHT, NULL,
-                                    eail_action_scroll_right);
+   static const EailActionDef actions[] = {
+        {EAIL_STR_SCROLL_UP, NULL, eail_action_scroll_up},
+        {EAIL_STR_SCROLL_DOWN, NULL, eail_action_scroll_down},
+        {EAIL_STR_SCROLL_LEFT, NULL, eail_action_scroll_left},
+        {EAIL_STR_SCROLL_RIGHT, NULL, eail_action_scroll_right}
+   };
+
+   eail_action_widget_class_actions_append(EAIL_ACTION_WIDGET_CLASS(klass),
+                                           actions, G_N_ELEMENTS(actions));
 }
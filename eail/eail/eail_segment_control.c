@@ -109,10 +109,9 @@ eail_segment_control_ref_child(AtkObject *obj, gint i)
 
    if (elm_segment_control_item_count_get(widget) > i)
      {
-        child = eail_item_new(obj, ATK_ROLE_LIST_ITEM);
-        atk_object_initialize(child, elm_segment_control_item_get(widget, i));
-
-        g_object_ref(child);
+        child = eail_item_parent_ref_item_accessible
+           (EAIL_ITEM_PARENT(obj), elm_segment_control_item_get(widget, i),
+            ATK_ROLE_LIST_ITEM);
      }
 
    return child;
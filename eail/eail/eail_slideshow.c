@@ -66,6 +66,7 @@ eail_slideshow_ref_child(AtkObject *obj, gint i)
 {
    Evas_Object *widget, *child_widget;
    Elm_Object_Item *it;
+   AtkObject *child;
 
    g_return_val_if_fail(EAIL_IS_SLIDESHOW(obj), NULL);
 
@@ -84,7 +85,10 @@ eail_slideshow_ref_child(AtkObject *obj, gint i)
         return NULL;
      }
 
-   return eail_factory_get_accessible(child_widget);
+   child = eail_factory_get_accessible(child_widget);
+   if (child) g_object_ref(child);
+
+   return child;
 }
 
 /**
@@ -229,6 +233,7 @@ eail_slideshow_ref_selection(AtkSelection *selection, gint i)
 {
    Evas_Object *widget, *it_widget;
    Elm_Object_Item *it;
+   AtkObject *obj;
 
    g_return_val_if_fail(EAIL_IS_SLIDESHOW(selection), NULL);
    g_return_val_if_fail(i == 0, NULL);
@@ -238,7 +243,10 @@ eail_slideshow_ref_selection(AtkSelection *selection, gint i)
 
    it_widget = elm_slideshow_item_object_get(it);
 
-   return eail_factory_get_accessible(it_widget);
+   obj = eail_factory_get_accessible(it_widget);
+   if (obj) g_object_ref(obj);
+
+   return obj;
 }
 
 /**
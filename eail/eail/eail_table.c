@@ -27,7 +27,13 @@
 
 #define TABLE_SMART_TYPE "Evas_Object_Table"
 
-G_DEFINE_TYPE(EailTable, eail_table, EAIL_TYPE_WIDGET)
+static void atk_table_interface_init(AtkTableIface *iface);
+
+G_DEFINE_TYPE_WITH_CODE(EailTable,
+                        eail_table,
+                        EAIL_TYPE_WIDGET,
+                        G_IMPLEMENT_INTERFACE(ATK_TYPE_TABLE,
+                                              atk_table_interface_init))
 
 /**
  * @brief Implementation of get_widget_childreb from EailWidget
@@ -69,6 +75,21 @@ eail_table_children_get(EailWidget *widget)
 static void
 eail_table_init(EailTable *table)
 {
+   table->cells = NULL;
+   table->cells_serial = 0;
+}
+
+/**
+ * @brief EailTable finalize
+ *
+ * @param object EailTable instance
+ */
+static void
+eail_table_finalize(GObject *object)
+{
+   eail_cell_index_free(EAIL_TABLE(object)->cells);
+
+   G_OBJECT_CLASS(eail_table_parent_class)->finalize(object);
 }
 
 /**
@@ -95,9 +116,71 @@ eail_table_class_init(EailTableClass *klass)
 {
    AtkObjectClass *class = ATK_OBJECT_CLASS(klass);
    EailWidgetClass *widget_class = EAIL_WIDGET_CLASS(klass);
+   GObjectClass *gobject_class = G_OBJECT_CLASS(klass);
 
    widget_class->get_widget_children = eail_table_children_get;
 
    class->initialize = eail_table_initialize;
+
+   gobject_class->finalize = eail_table_finalize;
 }
 
+/**
+ * @brief Gets position and span of child packed in table
+ *
+ * @param child child of table
+ * @param row pointer to store first row of child
+ * @param column pointer to store first column of child
+ * @param row_span pointer to store number of rows child spans
+ * @param column_span pointer to store number of columns child spans
+ */
+static void
+eail_table_pack_get(Evas_Object *child, gint *row, gint *column,
+                    gint *row_span, gint *column_span)
+{
+   elm_table_pack_get(child, column, row, column_span, row_span);
+}
+
+/**
+ * @brief Gets cells of table children
+ *
+ * Cells are taken from elm_table_pack_get once per change of children, that
+ * is when content is packed or unpacked, or table size hints change because
+ * content has been packed again at other place.
+ *
+ * @param table EailTable instance
+ *
+ * @returns cell index of children
+ */
+static EailCellIndex *
+eail_table_cells_get(AtkTable *table)
+{
+   EailTable *eail_table = EAIL_TABLE(table);
+   EailWidget *widget = EAIL_WIDGET(table);
+   Eina_Array *children = eail_widget_get_cached_children(widget);
+
+   if (eail_table->cells &&
+       eail_table->cells_serial == widget->children_serial &&
+       eail_cell_index_is_valid(eail_table->cells))
+     return eail_table->cells;
+
+   eail_cell_index_free(eail_table->cells);
+   eail_table->cells = eail_cell_index_new_for_children
+      (widget->widget, children, eail_table_pack_get, FALSE);
+   eail_table->cells_serial = widget->children_serial;
+
+   return eail_table->cells;
+}
+
+/**
+ * @brief AtkTable interface initialization
+ *
+ * @param iface AtkTable interface
+ */
+static void
+atk_table_interface_init(AtkTableIface *iface)
+{
+   if (!iface) return;
+
+   eail_cell_index_table_interface_init(iface, eail_table_cells_get);
+}
@@ -20,6 +20,7 @@
 #define EAIL_TABLE_H
 
 #include "eail_widget.h"
+#include "eail_cell_index.h"
 
 #define EAIL_TYPE_TABLE             (eail_table_get_type())
 #define EAIL_TABLE(obj)             (G_TYPE_CHECK_INSTANCE_CAST((obj), \
@@ -42,6 +43,9 @@ typedef struct _EailTableClass EailTableClass;
 struct _EailTable
 {
     EailWidget parent; /*!< EailTable parent object*/
+
+    EailCellIndex *cells; /*!< cells of children, NULL if not built yet*/
+    unsigned int cells_serial; /*!< children serial cells were built for*/
 };
 
 struct _EailTableClass
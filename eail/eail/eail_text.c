@@ -22,6 +22,8 @@
  * @brief EailText implementation
  */
 
+#include <string.h>
+#include <Ecore_Evas.h>
 #include <Elementary.h>
 
 #include "eail_text.h"
@@ -43,6 +45,259 @@ G_DEFINE_TYPE_WITH_CODE(EailText,
                         G_IMPLEMENT_INTERFACE(ATK_TYPE_TEXT,
                                               atk_text_interface_init));
 
+/**
+ * @brief Smart signals emitted by widgets when their text has changed
+ */
+#define EAIL_TEXT_CHANGED_NAME "changed"
+#define EAIL_TEXT_CHANGED_USER_NAME "changed,user"
+
+/**
+ * @brief Geometry of one line of text laid out in textblock
+ */
+typedef struct
+{
+   gint start;/*!< offset of the first character of line */
+   gint line;/*!< line number in textblock */
+   Evas_Coord x;/*!< x coordinate relative to textblock */
+   Evas_Coord y;/*!< y coordinate relative to textblock */
+   Evas_Coord w;/*!< line width */
+   Evas_Coord h;/*!< line height */
+} EailTextLine;
+
+/**
+ * @brief Part of text sharing the same attributes
+ */
+typedef struct
+{
+   gint start;/*!< offset of the first character of run */
+   gint end;/*!< offset after the last character of run */
+   AtkAttributeSet *attributes;/*!< attributes set on run */
+} EailTextRun;
+
+/**
+ * @brief Drops cached attribute runs of widget
+ *
+ * @param text an EailText
+ */
+static void
+_eail_text_drop_runs(EailText *text)
+{
+   guint i;
+
+   if (text->runs)
+     {
+        for (i = 0; i < text->runs->len; ++i)
+          atk_attribute_set_free(g_array_index(text->runs, EailTextRun,
+                                               i).attributes);
+        g_array_free(text->runs, TRUE);
+     }
+   text->runs = NULL;
+
+   atk_attribute_set_free(text->default_attributes);
+   text->default_attributes = NULL;
+}
+
+/**
+ * @brief Drops cached line geometry of widget
+ *
+ * @param text an EailText
+ */
+static void
+_eail_text_drop_lines(EailText *text)
+{
+   if (text->lines) g_array_free(text->lines, TRUE);
+   text->lines = NULL;
+   if (text->buffer) eail_text_buffer_drop_lines(text->buffer);
+}
+
+/**
+ * @brief Drops cached text of widget
+ *
+ * @param text an EailText
+ */
+void
+eail_text_invalidate_buffer(EailText *text)
+{
+   g_return_if_fail(EAIL_IS_TEXT(text));
+
+   _eail_text_drop_lines(text);
+   _eail_text_drop_runs(text);
+   eail_text_buffer_free(text->buffer);
+   text->buffer = NULL;
+}
+
+/**
+ * @brief Gets cached plain text of widget, fetching it if needed
+ *
+ * Widget markup is converted to plain text, so offsets match text visible on
+ * screen. Text of widgets tracked with eail_text_track_changes is fetched
+ * again only after change signal. Otherwise widget markup is compared with
+ * the one buffer was built from, which is much cheaper than converting it
+ * again.
+ *
+ * @param text an EailText
+ * @return EailTextBuffer owned by text or NULL if widget has no text
+ */
+EailTextBuffer *
+eail_text_get_buffer(EailText *text)
+{
+   Evas_Object *widget;
+   const char *markup;
+
+   g_return_val_if_fail(EAIL_IS_TEXT(text), NULL);
+
+   if (text->buffer && text->tracked) return text->buffer;
+
+   widget = eail_widget_get_widget(EAIL_WIDGET(text));
+   if (!widget) return NULL;
+
+   /* lines and runs were computed for old text, so drop them with it */
+   markup = elm_object_text_get(widget);
+   if (text->buffer && g_strcmp0(text->buffer->markup, markup))
+     eail_text_invalidate_buffer(text);
+
+   text->buffer = eail_text_buffer_update(text->buffer, markup);
+
+   return text->buffer;
+}
+
+/**
+ * @brief Gets textblock of widget
+ *
+ * @param text an EailText
+ * @return textblock laying out widget text or NULL if there is none
+ */
+static Evas_Object *
+_eail_text_get_textblock(EailText *text)
+{
+   EailTextClass *klass = EAIL_TEXT_GET_CLASS(text);
+   Evas_Object *textblock;
+
+   if (!klass->get_textblock) return NULL;
+
+   textblock = klass->get_textblock(text);
+   if (!textblock ||
+       g_strcmp0(evas_object_type_get(textblock), "textblock"))
+     return NULL;
+
+   return textblock;
+}
+
+/**
+ * @brief Gets buffer with line breaks matching widget layout
+ *
+ * Line starts and line geometry are read from textblock of widget once per
+ * buffer, so they are fetched again only after text change or resize.
+ * Widgets without textblock are split on line separators only.
+ *
+ * @param text an EailText
+ * @return EailTextBuffer owned by text or NULL if widget has no text
+ */
+static EailTextBuffer *
+_eail_text_get_laid_out_buffer(EailText *text)
+{
+   EailTextBuffer *buffer;
+   Evas_Textblock_Cursor *cur;
+   Evas_Object *textblock;
+   EailTextLine line;
+   gint *starts;
+   guint i;
+
+   buffer = eail_text_get_buffer(text);
+   if (!buffer || buffer->lines_valid) return buffer;
+
+   _eail_text_drop_lines(text);
+
+   textblock = _eail_text_get_textblock(text);
+   if (!textblock) return buffer;
+
+   text->lines = g_array_new(FALSE, FALSE, sizeof(EailTextLine));
+   cur = evas_object_textblock_cursor_new(textblock);
+   for (line.line = 0; evas_textblock_cursor_line_set(cur, line.line);
+        ++line.line)
+     {
+        line.start = evas_textblock_cursor_pos_get(cur);
+        if (line.start < 0 || line.start > buffer->length) break;
+        if (text->lines->len &&
+            line.start <= g_array_index(text->lines, EailTextLine,
+                                        text->lines->len - 1).start)
+          continue;
+
+        evas_textblock_cursor_line_geometry_get(cur, &line.x, &line.y,
+                                                &line.w, &line.h);
+        g_array_append_val(text->lines, line);
+     }
+   evas_textblock_cursor_free(cur);
+
+   /* textblock out of sync with widget text, use line separators */
+   if (!text->lines->len ||
+       g_array_index(text->lines, EailTextLine, 0).start != 0)
+     {
+        _eail_text_drop_lines(text);
+        return buffer;
+     }
+
+   starts = g_new(gint, text->lines->len);
+   for (i = 0; i < text->lines->len; ++i)
+     starts[i] = g_array_index(text->lines, EailTextLine, i).start;
+   eail_text_buffer_set_line_starts(buffer, starts, text->lines->len);
+
+   return buffer;
+}
+
+/**
+ * @brief Callback for resize of widget, drops cached layout of text
+ *
+ * @param data an EailText
+ * @param e an Evas
+ * @param obj widget which was resized
+ * @param event_info additional event info (not used here)
+ */
+static void
+_eail_text_on_resize(void *data, Evas *e, Evas_Object *obj, void *event_info)
+{
+   _eail_text_drop_lines(EAIL_TEXT(data));
+}
+
+/**
+ * @brief Callback for text change signals of widget
+ *
+ * @param data an EailText
+ * @param obj widget which text has changed
+ * @param event_info additional event info (not used here)
+ */
+static void
+_eail_text_on_changed(void *data, Evas_Object *obj, void *event_info)
+{
+   eail_text_invalidate_buffer(EAIL_TEXT(data));
+}
+
+/**
+ * @brief Makes cached text dropped only on text change signals of widget
+ *
+ * Should be used for widgets which emit "changed" signal on every text
+ * change, like entries.
+ *
+ * @param text an EailText
+ */
+void
+eail_text_track_changes(EailText *text)
+{
+   Evas_Object *widget;
+
+   g_return_if_fail(EAIL_IS_TEXT(text));
+
+   widget = eail_widget_get_widget(EAIL_WIDGET(text));
+   if (!widget || text->tracked) return;
+
+   evas_object_smart_callback_add(widget, EAIL_TEXT_CHANGED_NAME,
+                                  _eail_text_on_changed, text);
+   evas_object_smart_callback_add(widget, EAIL_TEXT_CHANGED_USER_NAME,
+                                  _eail_text_on_changed, text);
+   eail_text_invalidate_buffer(text);
+   text->tracked = EINA_TRUE;
+}
+
 /**
  * @brief EailText initializer
  *
@@ -52,9 +307,16 @@ G_DEFINE_TYPE_WITH_CODE(EailText,
 static void
 eail_text_initialize(AtkObject *obj, gpointer data)
 {
+   Evas_Object *widget;
+
    ATK_OBJECT_CLASS(eail_text_parent_class)->initialize(obj, data);
 
    obj->role = ATK_ROLE_TEXT;
+
+   widget = eail_widget_get_widget(EAIL_WIDGET(obj));
+   if (widget)
+     evas_object_event_callback_add(widget, EVAS_CALLBACK_RESIZE,
+                                    _eail_text_on_resize, obj);
 }
 
 /**
@@ -90,6 +352,24 @@ eail_text_get_name(AtkObject *obj)
 static void
 eail_text_init(EailText *text)
 {
+   text->buffer = NULL;
+   text->tracked = EINA_FALSE;
+   text->lines = NULL;
+   text->runs = NULL;
+   text->default_attributes = NULL;
+}
+
+/**
+ * @brief EailText finalizer
+ *
+ * @param obj a GObject
+ */
+static void
+eail_text_finalize(GObject *obj)
+{
+   eail_text_invalidate_buffer(EAIL_TEXT(obj));
+
+   G_OBJECT_CLASS(eail_text_parent_class)->finalize(obj);
 }
 
 /**
@@ -101,9 +381,13 @@ static void
 eail_text_class_init(EailTextClass *klass)
 {
    AtkObjectClass *class = ATK_OBJECT_CLASS(klass);
+   GObjectClass *g_object_class = G_OBJECT_CLASS(klass);
 
    class->initialize = eail_text_initialize;
    class->get_name = eail_text_get_name;
+   g_object_class->finalize = eail_text_finalize;
+
+   klass->get_textblock = NULL;
 }
 
 /*
@@ -126,13 +410,11 @@ eail_text_get_text(AtkText   *text,
                    gint       start_offset,
                    gint       end_offset)
 {
-   gchar *string = NULL;
-   Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(text));
+   EailTextBuffer *buffer = eail_text_get_buffer(EAIL_TEXT(text));
 
-   if (widget)
-     string = (gchar *)elm_object_text_get(widget);
+   if (!buffer) return NULL;
 
-   return eail_get_substring(string, start_offset, end_offset);
+   return eail_text_buffer_get_text(buffer, start_offset, end_offset);
 }
 
 /**
@@ -146,14 +428,11 @@ static gunichar
 eail_text_get_character_at_offset(AtkText    *text,
                                   gint        offset)
 {
-   gunichar character = '\0';
-   Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(text));
+   EailTextBuffer *buffer = eail_text_get_buffer(EAIL_TEXT(text));
 
-   if (widget)
-     character = g_utf8_get_char(
-         g_utf8_offset_to_pointer(elm_object_text_get(widget), offset));
+   if (!buffer) return '\0';
 
-   return character;
+   return eail_text_buffer_get_char(buffer, offset);
 }
 
 /**
@@ -165,13 +444,870 @@ eail_text_get_character_at_offset(AtkText    *text,
 static gint
 eail_text_get_character_count(AtkText *text)
 {
-   gint count = 0;
-   Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(text));
+   EailTextBuffer *buffer = eail_text_get_buffer(EAIL_TEXT(text));
 
-   if (widget)
-     count = g_utf8_strlen(elm_object_text_get(widget), -1);
+   if (!buffer) return 0;
+
+   return buffer->length;
+}
+
+/**
+ * @brief Gets text delimited by boundary type near offset
+ *
+ * @param text an AtkText
+ * @param boundary_type an AtkTextBoundary
+ * @param offset position
+ * @param relation position of returned text relative to offset
+ * @param [out] start_offset start offset of returned text
+ * @param [out] end_offset end offset of returned text
+ * @return newly allocated string, NULL if widget has no text
+ */
+static gchar *
+_eail_text_get_text_by_boundary(AtkText *text,
+                                AtkTextBoundary boundary_type,
+                                gint offset,
+                                EailTextRelation relation,
+                                gint *start_offset,
+                                gint *end_offset)
+{
+   EailTextBuffer *buffer;
+
+   buffer = _eail_text_get_laid_out_buffer(EAIL_TEXT(text));
+   if (!buffer)
+     {
+        *start_offset = *end_offset = 0;
+        return NULL;
+     }
+
+   return eail_text_buffer_get_text_by_boundary(buffer, boundary_type, offset,
+                                                relation, start_offset,
+                                                end_offset);
+}
+
+/**
+ * @brief Gets the specified text at offset
+ *
+ * Use g_free() to free the returned string
+ *
+ * @param text an AtkText
+ * @param offset position
+ * @param boundary_type an AtkTextBoundary
+ * @param [out] start_offset start offset of returned text
+ * @param [out] end_offset end offset of returned text
+ * @return newly allocated string containing text at offset
+ */
+static gchar *
+eail_text_get_text_at_offset(AtkText *text,
+                             gint offset,
+                             AtkTextBoundary boundary_type,
+                             gint *start_offset,
+                             gint *end_offset)
+{
+   return _eail_text_get_text_by_boundary(text, boundary_type, offset,
+                                          EAIL_TEXT_AT_OFFSET,
+                                          start_offset, end_offset);
+}
+
+/**
+ * @brief Gets the specified text before offset
+ *
+ * Use g_free() to free the returned string
+ *
+ * @param text an AtkText
+ * @param offset position
+ * @param boundary_type an AtkTextBoundary
+ * @param [out] start_offset start offset of returned text
+ * @param [out] end_offset end offset of returned text
+ * @return newly allocated string containing text before offset
+ */
+static gchar *
+eail_text_get_text_before_offset(AtkText *text,
+                                 gint offset,
+                                 AtkTextBoundary boundary_type,
+                                 gint *start_offset,
+                                 gint *end_offset)
+{
+   return _eail_text_get_text_by_boundary(text, boundary_type, offset,
+                                          EAIL_TEXT_BEFORE_OFFSET,
+                                          start_offset, end_offset);
+}
+
+/**
+ * @brief Gets the specified text after offset
+ *
+ * Use g_free() to free the returned string
+ *
+ * @param text an AtkText
+ * @param offset position
+ * @param boundary_type an AtkTextBoundary
+ * @param [out] start_offset start offset of returned text
+ * @param [out] end_offset end offset of returned text
+ * @return newly allocated string containing text after offset
+ */
+static gchar *
+eail_text_get_text_after_offset(AtkText *text,
+                                gint offset,
+                                AtkTextBoundary boundary_type,
+                                gint *start_offset,
+                                gint *end_offset)
+{
+   return _eail_text_get_text_by_boundary(text, boundary_type, offset,
+                                          EAIL_TEXT_AFTER_OFFSET,
+                                          start_offset, end_offset);
+}
+
+/**
+ * @brief Gets origin of textblock in requested coordinates
+ *
+ * @param textblock textblock of widget
+ * @param coord_type type of coordinates
+ * @param [out] x x coordinate of textblock origin
+ * @param [out] y y coordinate of textblock origin
+ */
+static void
+_eail_text_textblock_origin(Evas_Object *textblock,
+                            AtkCoordType coord_type,
+                            gint *x,
+                            gint *y)
+{
+   evas_object_geometry_get(textblock, x, y, NULL, NULL);
+
+   if (coord_type == ATK_XY_SCREEN)
+     {
+        int ee_x, ee_y;
+        Ecore_Evas *ee =
+           ecore_evas_ecore_evas_get(evas_object_evas_get(textblock));
+
+        ecore_evas_geometry_get(ee, &ee_x, &ee_y, NULL, NULL);
+        *x += ee_x;
+        *y += ee_y;
+     }
+}
+
+/**
+ * @brief Gets textblock of widget with its layout cached
+ *
+ * @param text an EailText
+ * @return textblock or NULL if line geometry of text is not available
+ */
+static Evas_Object *
+_eail_text_get_laid_out_textblock(EailText *text)
+{
+   if (!_eail_text_get_laid_out_buffer(text) || !text->lines) return NULL;
+
+   return _eail_text_get_textblock(text);
+}
+
+/**
+ * @brief Finds cached line containing character at offset
+ *
+ * @param text an EailText with cached lines
+ * @param offset character offset
+ * @return index of line in cache
+ */
+static guint
+_eail_text_line_at_offset(EailText *text, gint offset)
+{
+   guint low = 0, high = text->lines->len - 1, middle;
+
+   while (low < high)
+     {
+        middle = (low + high + 1) / 2;
+        if (g_array_index(text->lines, EailTextLine, middle).start <= offset)
+          low = middle;
+        else
+          high = middle - 1;
+     }
+
+   return low;
+}
+
+/**
+ * @brief Finds cached line at given height
+ *
+ * @param text an EailText with cached lines
+ * @param y y coordinate relative to textblock
+ * @return EailTextLine or NULL if there is no line at y
+ */
+static EailTextLine *
+_eail_text_line_at_y(EailText *text, Evas_Coord y)
+{
+   guint low = 0, high = text->lines->len, middle;
+   EailTextLine *line;
+
+   /* first line ending below y */
+   while (low < high)
+     {
+        middle = (low + high) / 2;
+        line = &g_array_index(text->lines, EailTextLine, middle);
+        if (line->y + line->h <= y)
+          low = middle + 1;
+        else
+          high = middle;
+     }
+
+   if (low == text->lines->len) return NULL;
+
+   line = &g_array_index(text->lines, EailTextLine, low);
+   if (y < line->y) return NULL;
+
+   return line;
+}
+
+/**
+ * @brief Gets bounding box of character at offset
+ *
+ * Only character geometry is asked from textblock, which keeps its layout,
+ * so no text is laid out again.
+ *
+ * @param text an AtkText
+ * @param offset character offset
+ * @param [out] x x coordinate of character
+ * @param [out] y y coordinate of character
+ * @param [out] width width of character
+ * @param [out] height height of character
+ * @param coords type of coordinates
+ */
+static void
+eail_text_get_character_extents(AtkText *text,
+                                gint offset,
+                                gint *x,
+                                gint *y,
+                                gint *width,
+                                gint *height,
+                                AtkCoordType coords)
+{
+   EailText *eail_text = EAIL_TEXT(text);
+   Evas_Textblock_Cursor *cur;
+   Evas_Object *textblock;
+   EailTextLine *line;
+   Evas_Coord cx, cy, cw, ch;
+   gint origin_x, origin_y;
+
+   *x = *y = G_MININT;
+   *width = *height = -1;
+
+   textblock = _eail_text_get_laid_out_textblock(eail_text);
+   if (!textblock || offset < 0 || offset > eail_text->buffer->length) return;
+
+   cur = evas_object_textblock_cursor_new(textblock);
+   evas_textblock_cursor_pos_set(cur, offset);
+   if (evas_textblock_cursor_char_geometry_get(cur, &cx, &cy, &cw, &ch) < 0)
+     {
+        evas_textblock_cursor_free(cur);
+        return;
+     }
+   evas_textblock_cursor_free(cur);
+
+   /* characters share height of their line */
+   line = &g_array_index(eail_text->lines, EailTextLine,
+                         _eail_text_line_at_offset(eail_text, offset));
+   if (line->h > 0)
+     {
+        cy = line->y;
+        ch = line->h;
+     }
+
+   _eail_text_textblock_origin(textblock, coords, &origin_x, &origin_y);
+   *x = origin_x + cx;
+   *y = origin_y + cy;
+   *width = cw;
+   *height = ch;
+}
+
+/**
+ * @brief Gets bounding box of text range
+ *
+ * Boxes of lines between the first and the last character are taken from
+ * cached line geometry.
+ *
+ * @param text an AtkText
+ * @param start_offset offset of the first character
+ * @param end_offset offset after the last character
+ * @param coord_type type of coordinates
+ * @param [out] rect bounding box of text range
+ */
+static void
+eail_text_get_range_extents(AtkText *text,
+                            gint start_offset,
+                            gint end_offset,
+                            AtkCoordType coord_type,
+                            AtkTextRectangle *rect)
+{
+   EailText *eail_text = EAIL_TEXT(text);
+   Evas_Object *textblock;
+   EailTextLine *line;
+   gint x1, y1, x2, y2, x, y, w, h;
+   guint first, last, i;
+
+   rect->x = rect->y = G_MININT;
+   rect->width = rect->height = -1;
+
+   textblock = _eail_text_get_laid_out_textblock(eail_text);
+   if (!textblock) return;
+
+   if (end_offset < 0 || end_offset > eail_text->buffer->length)
+     end_offset = eail_text->buffer->length;
+   if (start_offset < 0 || start_offset >= end_offset) return;
+
+   eail_text_get_character_extents(text, start_offset, &x1, &y1, &w, &h,
+                                   coord_type);
+   if (w < 0) return;
+   x2 = x1 + w;
+   y2 = y1 + h;
+
+   eail_text_get_character_extents(text, end_offset - 1, &x, &y, &w, &h,
+                                   coord_type);
+   if (w >= 0)
+     {
+        x1 = MIN(x1, x);
+        y1 = MIN(y1, y);
+        x2 = MAX(x2, x + w);
+        y2 = MAX(y2, y + h);
+     }
+
+   first = _eail_text_line_at_offset(eail_text, start_offset);
+   last = _eail_text_line_at_offset(eail_text, end_offset - 1);
+   if (first != last)
+     {
+        /* range spans lines, their cached boxes bound it horizontally */
+        _eail_text_textblock_origin(textblock, coord_type, &x, &y);
+        for (i = first; i <= last; ++i)
+          {
+             line = &g_array_index(eail_text->lines, EailTextLine, i);
+             x1 = MIN(x1, x + line->x);
+             y1 = MIN(y1, y + line->y);
+             x2 = MAX(x2, x + line->x + line->w);
+             y2 = MAX(y2, y + line->y + line->h);
+          }
+     }
+
+   rect->x = x1;
+   rect->y = y1;
+   rect->width = x2 - x1;
+   rect->height = y2 - y1;
+}
+
+/**
+ * @brief Gets offset of character at given point
+ *
+ * Line under the point is found in cached line geometry, then textblock
+ * looks the character up in that line only.
+ *
+ * @param text an AtkText
+ * @param x x coordinate
+ * @param y y coordinate
+ * @param coords type of coordinates
+ * @return character offset or -1 if there is no text at point
+ */
+static gint
+eail_text_get_offset_at_point(AtkText *text,
+                              gint x,
+                              gint y,
+                              AtkCoordType coords)
+{
+   EailText *eail_text = EAIL_TEXT(text);
+   Evas_Textblock_Cursor *cur;
+   Evas_Object *textblock;
+   EailTextLine *line;
+   gint origin_x, origin_y, offset;
+
+   textblock = _eail_text_get_laid_out_textblock(eail_text);
+   if (!textblock) return -1;
+
+   _eail_text_textblock_origin(textblock, coords, &origin_x, &origin_y);
+   x -= origin_x;
+   y -= origin_y;
+
+   line = _eail_text_line_at_y(eail_text, y);
+   if (!line || x < line->x || x >= line->x + line->w) return -1;
+
+   cur = evas_object_textblock_cursor_new(textblock);
+   if (evas_textblock_cursor_char_coord_set(cur, x, line->y + line->h / 2))
+     offset = evas_textblock_cursor_pos_get(cur);
+   else
+     offset = -1;
+   evas_textblock_cursor_free(cur);
+
+   return offset;
+}
+
+/**
+ * @brief Textblock format names mapped to ATK text attributes
+ */
+static const struct
+{
+   const char *format;/*!< textblock format name */
+   AtkTextAttribute attribute;/*!< ATK text attribute */
+} _eail_text_format_attributes[] =
+{
+   { "font", ATK_TEXT_ATTR_FAMILY_NAME },
+   { "font_size", ATK_TEXT_ATTR_SIZE },
+   { "font_weight", ATK_TEXT_ATTR_WEIGHT },
+   { "font_style", ATK_TEXT_ATTR_STYLE },
+   { "color", ATK_TEXT_ATTR_FG_COLOR },
+   { "backing_color", ATK_TEXT_ATTR_BG_COLOR },
+   { "underline", ATK_TEXT_ATTR_UNDERLINE },
+   { "strikethrough", ATK_TEXT_ATTR_STRIKETHROUGH },
+   { "wrap", ATK_TEXT_ATTR_WRAP_MODE },
+   { "align", ATK_TEXT_ATTR_JUSTIFICATION }
+};
+
+/**
+ * @brief Font weight names used by textblock with their numeric values
+ */
+static const struct
+{
+   const char *name;/*!< weight name */
+   const char *value;/*!< numeric weight */
+} _eail_text_weights[] =
+{
+   { "thin", "100" },
+   { "ultralight", "200" },
+   { "extralight", "200" },
+   { "light", "300" },
+   { "book", "350" },
+   { "normal", "400" },
+   { "regular", "400" },
+   { "medium", "500" },
+   { "semibold", "600" },
+   { "demibold", "600" },
+   { "bold", "700" },
+   { "ultrabold", "800" },
+   { "extrabold", "800" },
+   { "black", "900" },
+   { "heavy", "900" },
+   { "extrablack", "950" },
+   { "ultrablack", "950" }
+};
+
+/**
+ * @brief Converts textblock color to ATK color
+ *
+ * @param color color in "#RGB", "#RGBA", "#RRGGBB" or "#RRGGBBAA" form
+ * @return newly allocated "r,g,b" string or NULL if color is not valid
+ */
+static gchar *
+_eail_text_color_convert(const char *color)
+{
+   guint rgb[3], i;
+   gsize len;
+   gint digits;
+
+   if (!color || color[0] != '#') return NULL;
+
+   color++;
+   len = strlen(color);
+   if (len == 3 || len == 4)
+     digits = 1;
+   else if (len == 6 || len == 8)
+     digits = 2;
+   else
+     return NULL;
+
+   for (i = 0; i < 3; ++i)
+     {
+        gint high = g_ascii_xdigit_value(color[i * digits]);
+        gint low = g_ascii_xdigit_value(color[i * digits + digits - 1]);
+
+        if (high < 0 || low < 0) return NULL;
+        rgb[i] = (high * 16 + low) * 257;
+     }
+
+   return g_strdup_printf("%u,%u,%u", rgb[0], rgb[1], rgb[2]);
+}
+
+/**
+ * @brief Converts textblock format value to ATK attribute value
+ *
+ * @param attribute ATK text attribute
+ * @param value textblock format value
+ * @return newly allocated value or NULL if value is not supported
+ */
+static gchar *
+_eail_text_attribute_value_convert(AtkTextAttribute attribute,
+                                   const char *value)
+{
+   guint i;
+
+   switch (attribute)
+     {
+      case ATK_TEXT_ATTR_FAMILY_NAME:
+         /* "Sans:style=Bold" */
+         return g_strndup(value, strcspn(value, ":"));
+      case ATK_TEXT_ATTR_WEIGHT:
+         for (i = 0; i < G_N_ELEMENTS(_eail_text_weights); ++i)
+           if (!g_ascii_strcasecmp(value, _eail_text_weights[i].name))
+             return g_strdup(_eail_text_weights[i].value);
+         return NULL;
+      case ATK_TEXT_ATTR_FG_COLOR:
+      case ATK_TEXT_ATTR_BG_COLOR:
+         return _eail_text_color_convert(value);
+      case ATK_TEXT_ATTR_UNDERLINE:
+         if (!strcmp(value, "off")) return g_strdup("none");
+         if (!strcmp(value, "double")) return g_strdup("double");
+         return g_strdup("single");
+      case ATK_TEXT_ATTR_STRIKETHROUGH:
+         return g_strdup(strcmp(value, "off") ? "true" : "false");
+      case ATK_TEXT_ATTR_WRAP_MODE:
+         if (!strcmp(value, "mixed")) return g_strdup("word");
+         return g_strdup(value);
+      case ATK_TEXT_ATTR_JUSTIFICATION:
+         if (!strcmp(value, "middle")) return g_strdup("center");
+         if (!strcmp(value, "auto")) return NULL;
+         return g_strdup(value);
+      default:
+         return g_ascii_strdown(value, -1);
+     }
+}
+
+/**
+ * @brief Applies textblock format to attributes
+ *
+ * Tags defined by default Elementary styles are mapped to their meaning,
+ * "key=value" pairs are converted one by one.
+ *
+ * @param attributes GHashTable mapping attribute names to values
+ * @param format textblock format without push or pop prefix
+ */
+static void
+_eail_text_format_apply(GHashTable *attributes, const char *format)
+{
+   AtkTextAttribute attribute;
+   gchar **tokens, *value;
+   guint i, j;
+
+   if (!strcmp(format, "b") || !strcmp(format, "strong"))
+     format = "font_weight=Bold";
+   else if (!strcmp(format, "i") || !strcmp(format, "em"))
+     format = "font_style=Italic";
+
+   tokens = g_strsplit(format, " ", 0);
+   for (i = 0; tokens[i]; ++i)
+     {
+        char *eq = strchr(tokens[i], '=');
+
+        if (!eq) continue;
+        *eq = '\0';
+
+        for (j = 0; j < G_N_ELEMENTS(_eail_text_format_attributes); ++j)
+          if (!strcmp(tokens[i], _eail_text_format_attributes[j].format))
+            break;
+        if (j == G_N_ELEMENTS(_eail_text_format_attributes)) continue;
+
+        attribute = _eail_text_format_attributes[j].attribute;
+        value = _eail_text_attribute_value_convert(attribute,
+                                                   g_strstrip(eq + 1));
+        if (value)
+          g_hash_table_replace(attributes,
+                               (gpointer)atk_text_attribute_get_name(attribute),
+                               value);
+     }
+   g_strfreev(tokens);
+}
+
+/**
+ * @brief Converts attributes table to AtkAttributeSet
+ *
+ * @param attributes GHashTable mapping attribute names to values
+ * @return newly allocated AtkAttributeSet
+ */
+static AtkAttributeSet *
+_eail_text_attribute_set_new(GHashTable *attributes)
+{
+   AtkAttributeSet *set = NULL;
+   GHashTableIter iter;
+   gpointer name, value;
+
+   g_hash_table_iter_init(&iter, attributes);
+   while (g_hash_table_iter_next(&iter, &name, &value))
+     {
+        AtkAttribute *attr = g_new(AtkAttribute, 1);
+
+        attr->name = g_strdup(name);
+        attr->value = g_strdup(value);
+        set = g_slist_prepend(set, attr);
+     }
+
+   return set;
+}
+
+/**
+ * @brief Copies AtkAttributeSet
+ *
+ * @param set an AtkAttributeSet
+ * @return newly allocated copy of set
+ */
+static AtkAttributeSet *
+_eail_text_attribute_set_copy(AtkAttributeSet *set)
+{
+   AtkAttributeSet *copy = NULL;
+
+   for (; set; set = set->next)
+     {
+        AtkAttribute *attr = g_new(AtkAttribute, 1);
+
+        attr->name = g_strdup(((AtkAttribute *)set->data)->name);
+        attr->value = g_strdup(((AtkAttribute *)set->data)->value);
+        copy = g_slist_prepend(copy, attr);
+     }
+
+   return g_slist_reverse(copy);
+}
+
+/**
+ * @brief Checks if two attribute sets hold the same attributes
+ *
+ * @param a an AtkAttributeSet
+ * @param b an AtkAttributeSet
+ * @return TRUE if sets are equal, FALSE otherwise
+ */
+static gboolean
+_eail_text_attribute_set_equal(AtkAttributeSet *a, AtkAttributeSet *b)
+{
+   AtkAttributeSet *l, *m;
+
+   if (g_slist_length(a) != g_slist_length(b)) return FALSE;
+
+   for (l = a; l; l = l->next)
+     {
+        AtkAttribute *attr = l->data;
+
+        for (m = b; m; m = m->next)
+          if (!strcmp(attr->name, ((AtkAttribute *)m->data)->name))
+            break;
+        if (!m || strcmp(attr->value, ((AtkAttribute *)m->data)->value))
+          return FALSE;
+     }
+
+   return TRUE;
+}
+
+/**
+ * @brief Appends run of attributes set by formats on stack
+ *
+ * @param runs GArray of EailTextRun
+ * @param stack GPtrArray of formats in push order
+ * @param start offset of the first character of run
+ * @param end offset after the last character of run
+ */
+static void
+_eail_text_run_add(GArray *runs, GPtrArray *stack, gint start, gint end)
+{
+   EailTextRun run;
+   GHashTable *attributes;
+   guint i;
+
+   if (start >= end) return;
+
+   attributes = g_hash_table_new_full(g_str_hash, g_str_equal, NULL, g_free);
+   for (i = 0; i < stack->len; ++i)
+     _eail_text_format_apply(attributes, g_ptr_array_index(stack, i));
+
+   run.start = start;
+   run.end = end;
+   run.attributes = _eail_text_attribute_set_new(attributes);
+   g_hash_table_destroy(attributes);
+
+   /* e.g. line breaks split text without changing attributes */
+   if (runs->len)
+     {
+        EailTextRun *last = &g_array_index(runs, EailTextRun, runs->len - 1);
+
+        if (last->end == start &&
+            _eail_text_attribute_set_equal(last->attributes, run.attributes))
+          {
+             last->end = end;
+             atk_attribute_set_free(run.attributes);
+             return;
+          }
+     }
+
+   g_array_append_val(runs, run);
+}
+
+/**
+ * @brief Pops format from stack
+ *
+ * Format with given name is popped, the most recent one if name is empty.
+ *
+ * @param stack GPtrArray of formats in push order
+ * @param name name of popped format
+ */
+static void
+_eail_text_format_pop(GPtrArray *stack, const char *name)
+{
+   gsize len = strcspn(name, "= ");
+   gint i;
+
+   for (i = stack->len - 1; i >= 0 && len; --i)
+     {
+        const char *format = g_ptr_array_index(stack, i);
+
+        if (strcspn(format, "= ") == len && !strncmp(format, name, len))
+          break;
+     }
+
+   if (!len) i = stack->len - 1;
+   if (i >= 0) g_ptr_array_remove_index(stack, i);
+}
+
+/**
+ * @brief Builds table of attribute runs from textblock format nodes
+ *
+ * Format nodes are walked once, keeping a stack of formats pushed so far.
+ * Every part of text between two format nodes becomes a run, neighbouring
+ * runs with equal attributes are merged.
+ *
+ * @param text an EailText
+ */
+static void
+_eail_text_runs_build(EailText *text)
+{
+   const Evas_Object_Textblock_Node_Format *node;
+   const Evas_Textblock_Style *style;
+   Evas_Textblock_Cursor *cur;
+   Evas_Object *textblock;
+   GHashTable *defaults;
+   GPtrArray *stack;
+   const char *format, *style_text;
+   gint pos, last = 0;
+
+   text->runs = g_array_new(FALSE, FALSE, sizeof(EailTextRun));
+   stack = g_ptr_array_new_with_free_func(g_free);
+
+   /* without textblock the whole text is one run without attributes */
+   textblock = _eail_text_get_textblock(text);
+   if (!textblock)
+     {
+        _eail_text_run_add(text->runs, stack, 0, text->buffer->length);
+        g_ptr_array_free(stack, TRUE);
+        return;
+     }
+
+   cur = evas_object_textblock_cursor_new(textblock);
+   for (node = evas_textblock_node_format_first_get(textblock); node;
+        node = evas_textblock_node_format_next_get(node))
+     {
+        format = evas_textblock_node_format_text_get(node);
+        if (!format) continue;
+
+        evas_textblock_cursor_at_format_set(cur, node);
+        pos = MIN(evas_textblock_cursor_pos_get(cur), text->buffer->length);
+        _eail_text_run_add(text->runs, stack, last, pos);
+        last = MAX(last, pos);
+
+        if (format[0] == '+')
+          g_ptr_array_add(stack, g_strstrip(g_strdup(format + 1)));
+        else if (format[0] == '-')
+          {
+             gchar *name = g_strstrip(g_strdup(format + 1));
+
+             _eail_text_format_pop(stack, name);
+             g_free(name);
+          }
+     }
+   evas_textblock_cursor_free(cur);
+   _eail_text_run_add(text->runs, stack, last, text->buffer->length);
+   g_ptr_array_free(stack, TRUE);
+
+   /* DEFAULT='font=Sans font_size=10 color=#000' */
+   style = evas_object_textblock_style_get(textblock);
+   style_text = style ? evas_textblock_style_get(style) : NULL;
+   style_text = style_text ? strstr(style_text, "DEFAULT='") : NULL;
+   if (style_text)
+     {
+        gchar *def;
+
+        style_text += strlen("DEFAULT='");
+        def = g_strndup(style_text, strcspn(style_text, "'"));
+        defaults = g_hash_table_new_full(g_str_hash, g_str_equal, NULL,
+                                         g_free);
+        _eail_text_format_apply(defaults, def);
+        text->default_attributes = _eail_text_attribute_set_new(defaults);
+        g_hash_table_destroy(defaults);
+        g_free(def);
+     }
+}
+
+/**
+ * @brief Gets attribute runs of widget text, building them if needed
+ *
+ * Runs are kept until text of widget changes.
+ *
+ * @param text an EailText
+ * @return GArray of EailTextRun or NULL if widget has no text
+ */
+static GArray *
+_eail_text_get_runs(EailText *text)
+{
+   if (!eail_text_get_buffer(text)) return NULL;
+   if (!text->runs) _eail_text_runs_build(text);
+
+   return text->runs;
+}
+
+/**
+ * @brief Gets attributes of run containing offset
+ *
+ * Runs are looked up with binary search.
+ *
+ * @param text an AtkText
+ * @param offset character offset
+ * @param [out] start_offset start offset of run
+ * @param [out] end_offset end offset of run
+ * @return newly allocated AtkAttributeSet, free it with
+ * atk_attribute_set_free
+ */
+static AtkAttributeSet *
+eail_text_get_run_attributes(AtkText *text,
+                             gint offset,
+                             gint *start_offset,
+                             gint *end_offset)
+{
+   EailTextRun *run;
+   GArray *runs;
+   guint low = 0, high, middle;
+
+   *start_offset = *end_offset = -1;
+
+   runs = _eail_text_get_runs(EAIL_TEXT(text));
+   if (!runs || !runs->len || offset < 0) return NULL;
+
+   high = runs->len - 1;
+   while (low < high)
+     {
+        middle = (low + high + 1) / 2;
+        if (g_array_index(runs, EailTextRun, middle).start <= offset)
+          low = middle;
+        else
+          high = middle - 1;
+     }
+
+   run = &g_array_index(runs, EailTextRun, low);
+   if (offset >= run->end) return NULL;
+
+   *start_offset = run->start;
+   *end_offset = run->end;
+
+   return _eail_text_attribute_set_copy(run->attributes);
+}
+
+/**
+ * @brief Gets attributes applied to the whole text
+ *
+ * @param text an AtkText
+ * @return newly allocated AtkAttributeSet, free it with
+ * atk_attribute_set_free
+ */
+static AtkAttributeSet *
+eail_text_get_default_attributes(AtkText *text)
+{
+   EailText *eail_text = EAIL_TEXT(text);
+
+   if (!_eail_text_get_runs(eail_text)) return NULL;
 
-   return count;
+   return _eail_text_attribute_set_copy(eail_text->default_attributes);
 }
 
 /**
@@ -185,8 +1321,17 @@ atk_text_interface_init(AtkTextIface *iface)
    iface->get_text = eail_text_get_text;
    iface->get_character_at_offset = eail_text_get_character_at_offset;
    iface->get_character_count = eail_text_get_character_count;
+   iface->get_text_at_offset = eail_text_get_text_at_offset;
+   iface->get_text_before_offset = eail_text_get_text_before_offset;
+   iface->get_text_after_offset = eail_text_get_text_after_offset;
+   iface->get_character_extents = eail_text_get_character_extents;
+   iface->get_range_extents = eail_text_get_range_extents;
+   iface->get_offset_at_point = eail_text_get_offset_at_point;
+   iface->get_run_attributes = eail_text_get_run_attributes;
+   iface->get_default_attributes = eail_text_get_default_attributes;
 
    /*
-    * TODO: Implement other methods of AtkText interface
+    * TODO: Implement get_bounded_ranges, caret and selection methods are
+    * implemented by EailEntry only
     */
 }
@@ -25,6 +25,7 @@
 #define EAIL_TEXT_H
 
 #include "eail_widget.h"
+#include "eail_text_buffer.h"
 
 #define EAIL_TYPE_TEXT             (eail_text_get_type())
 #define EAIL_TEXT(obj)             (G_TYPE_CHECK_INSTANCE_CAST((obj), \
@@ -48,15 +49,31 @@ typedef struct _EailTextClass EailTextClass;
 struct _EailText
 {
    EailWidget parent;
+
+   EailTextBuffer *buffer;/*!< cached plain text, NULL if not fetched */
+   Eina_Bool tracked;/*!< buffer is invalidated by widget signals */
+   GArray *lines;/*!< cached geometry of laid out lines, NULL if not
+                   fetched */
+   GArray *runs;/*!< cached attribute runs, NULL if not fetched */
+   AtkAttributeSet *default_attributes;/*!< cached default attributes */
 };
 
 struct _EailTextClass
 {
    EailWidgetClass parent_class;
+
+   /**
+    * @brief Gets textblock laying out widget text, NULL if there is none
+    */
+   Evas_Object *(*get_textblock)(EailText *text);
 };
 
 GType eail_text_get_type(void);
 
+EailTextBuffer *eail_text_get_buffer(EailText *text);
+void eail_text_invalidate_buffer(EailText *text);
+void eail_text_track_changes(EailText *text);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,668 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/**
+ * @file eail_text_buffer.c
+ * @brief Implementation of plain text buffer shared by text accessibles
+ */
+
+#include <string.h>
+#include <Elementary.h>
+
+#include "eail_text_buffer.h"
+
+/**
+ * @brief Number of characters between two entries of offset index
+ *
+ * Finding a character never takes more than that many UTF-8 steps.
+ */
+#define EAIL_TEXT_BUFFER_STEP 32
+
+/**
+ * @brief Builds offset index of buffer text
+ *
+ * Index holding byte offset of every EAIL_TEXT_BUFFER_STEP-th character is
+ * built once, so characters and substrings are found without scanning text
+ * from its beginning. Pure ASCII text needs no index at all.
+ *
+ * @param buffer an EailTextBuffer with text set
+ */
+static void
+_eail_text_buffer_index(EailTextBuffer *buffer)
+{
+   const gchar *p;
+   gint i = 0;
+
+   buffer->size = strlen(buffer->text);
+
+   for (p = buffer->text; *p; ++p)
+     if ((guchar)*p >= 0x80) break;
+
+   if (!*p)
+     {
+        buffer->length = buffer->size;
+        return;
+     }
+
+   buffer->length = g_utf8_strlen(buffer->text, buffer->size);
+   buffer->index = g_new(gint, buffer->length / EAIL_TEXT_BUFFER_STEP + 1);
+
+   for (p = buffer->text; i < buffer->length; ++i, p = g_utf8_next_char(p))
+     if (i % EAIL_TEXT_BUFFER_STEP == 0)
+       buffer->index[i / EAIL_TEXT_BUFFER_STEP] = p - buffer->text;
+
+   if (i % EAIL_TEXT_BUFFER_STEP == 0)
+     buffer->index[i / EAIL_TEXT_BUFFER_STEP] = p - buffer->text;
+}
+
+/**
+ * @param text UTF-8 text to copy, NULL for empty buffer
+ *
+ * @returns newly allocated EailTextBuffer, should be freed with
+ * eail_text_buffer_free
+ */
+EailTextBuffer *
+eail_text_buffer_new(const gchar *text)
+{
+   EailTextBuffer *buffer;
+
+   buffer = g_new0(EailTextBuffer, 1);
+   buffer->text = g_strdup(text ? text : "");
+   _eail_text_buffer_index(buffer);
+
+   return buffer;
+}
+
+/**
+ * @brief Starts new segment of plain text
+ *
+ * @param segments array of EailTextSegment
+ * @param plain plain text converted so far
+ * @param length number of characters converted so far
+ * @param markup byte offset of segment source in markup
+ * @param literal whether segment is copied literally
+ */
+static void
+_eail_text_buffer_segment_add(GArray *segments, GString *plain, gint length,
+                              gint markup, gboolean literal)
+{
+   EailTextSegment segment;
+
+   segment.offset = length;
+   segment.byte = plain->len;
+   segment.markup = markup;
+   segment.literal = literal;
+
+   g_array_append_val(segments, segment);
+}
+
+/**
+ * Tags and escape sequences are converted one by one with
+ * elm_entry_markup_to_utf8, so plain text matches what Elementary reports,
+ * while literal text between them is copied directly. Every converted piece
+ * starts a segment, which maps plain text offsets back into markup.
+ *
+ * @param markup Elementary markup, NULL for empty buffer
+ *
+ * @returns newly allocated EailTextBuffer, should be freed with
+ * eail_text_buffer_free
+ */
+EailTextBuffer *
+eail_text_buffer_new_from_markup(const gchar *markup)
+{
+   EailTextBuffer *buffer;
+   GArray *segments;
+   GString *plain;
+   const gchar *p, *end;
+   gint length = 0;
+
+   if (!markup || !strpbrk(markup, "<&"))
+     {
+        buffer = eail_text_buffer_new(markup);
+        buffer->markup = g_strdup(markup);
+        return buffer;
+     }
+
+   segments = g_array_new(FALSE, FALSE, sizeof(EailTextSegment));
+   plain = g_string_sized_new(strlen(markup));
+
+   for (p = markup; *p; p = end)
+     {
+        if (*p == '<' || *p == '&')
+          {
+             char *token, *converted;
+
+             end = strchr(p, *p == '<' ? '>' : ';');
+             if (end)
+               {
+                  end++;
+                  token = g_strndup(p, end - p);
+                  converted = elm_entry_markup_to_utf8(token);
+                  g_free(token);
+
+                  _eail_text_buffer_segment_add(segments, plain, length,
+                                                p - markup, FALSE);
+                  if (converted)
+                    {
+                       g_string_append(plain, converted);
+                       length += g_utf8_strlen(converted, -1);
+                       free(converted);
+                    }
+                  continue;
+               }
+          }
+
+        /* literal text up to next tag or escape sequence */
+        end = p + 1 + strcspn(p + 1, "<&");
+        _eail_text_buffer_segment_add(segments, plain, length, p - markup,
+                                      TRUE);
+        g_string_append_len(plain, p, end - p);
+        length += g_utf8_strlen(p, end - p);
+     }
+
+   buffer = g_new0(EailTextBuffer, 1);
+   buffer->text = g_string_free(plain, FALSE);
+   buffer->markup = g_strdup(markup);
+   buffer->n_segments = segments->len;
+   buffer->segments = (EailTextSegment *)g_array_free(segments, FALSE);
+   _eail_text_buffer_index(buffer);
+
+   return buffer;
+}
+
+/**
+ * Markup comparison is much cheaper than converting and indexing it again.
+ *
+ * @param buffer an EailTextBuffer or NULL
+ * @param markup current markup, NULL if there is no text
+ *
+ * @returns buffer for given markup, old buffer is freed if it was built
+ * from different markup
+ */
+EailTextBuffer *
+eail_text_buffer_update(EailTextBuffer *buffer, const gchar *markup)
+{
+   if (buffer && !g_strcmp0(buffer->markup, markup))
+     return buffer;
+
+   eail_text_buffer_free(buffer);
+   if (!markup) return NULL;
+
+   return eail_text_buffer_new_from_markup(markup);
+}
+
+/**
+ * Segments are binary searched, so lookup takes logarithmic time.
+ *
+ * @param buffer an EailTextBuffer
+ * @param offset character offset, clamped to text bounds
+ *
+ * @returns byte offset in markup, character produced by tag or escape
+ * sequence is mapped to its beginning
+ */
+gint
+eail_text_buffer_offset_to_markup(const EailTextBuffer *buffer, gint offset)
+{
+   const EailTextSegment *segment;
+   gint low = 0, high = buffer->n_segments - 1, middle;
+   gint byte;
+
+   byte = eail_text_buffer_offset_to_pointer(buffer, offset) - buffer->text;
+
+   if (!buffer->markup) return byte;
+   if (!buffer->segments) return byte;
+   if (offset >= buffer->length) return strlen(buffer->markup);
+
+   while (low < high)
+     {
+        middle = (low + high + 1) / 2;
+        if (buffer->segments[middle].offset <= offset)
+          low = middle;
+        else
+          high = middle - 1;
+     }
+
+   segment = &buffer->segments[low];
+   if (!segment->literal) return segment->markup;
+
+   return segment->markup + byte - segment->byte;
+}
+
+/**
+ * @param buffer an EailTextBuffer
+ */
+void
+eail_text_buffer_free(EailTextBuffer *buffer)
+{
+   if (!buffer) return;
+
+   eail_text_buffer_drop_lines(buffer);
+   g_free(buffer->breaks[EAIL_TEXT_BREAK_WORD_START]);
+   g_free(buffer->breaks[EAIL_TEXT_BREAK_WORD_END]);
+   g_free(buffer->breaks[EAIL_TEXT_BREAK_SENTENCE_START]);
+   g_free(buffer->breaks[EAIL_TEXT_BREAK_SENTENCE_END]);
+   g_free(buffer->segments);
+   g_free(buffer->markup);
+   g_free(buffer->index);
+   g_free(buffer->text);
+   g_free(buffer);
+}
+
+/**
+ * @param buffer an EailTextBuffer
+ * @param offset character offset, clamped to text bounds
+ *
+ * @returns pointer to character inside buffer text
+ */
+const gchar *
+eail_text_buffer_offset_to_pointer(const EailTextBuffer *buffer, gint offset)
+{
+   const gchar *p;
+   gint i;
+
+   if (offset <= 0) return buffer->text;
+   if (offset >= buffer->length) return buffer->text + buffer->size;
+   if (!buffer->index) return buffer->text + offset;
+
+   p = buffer->text + buffer->index[offset / EAIL_TEXT_BUFFER_STEP];
+   for (i = offset % EAIL_TEXT_BUFFER_STEP; i > 0; --i)
+     p = g_utf8_next_char(p);
+
+   return p;
+}
+
+/**
+ * @param buffer an EailTextBuffer
+ * @param offset character offset
+ *
+ * @returns character at offset or '\0' if offset is out of text bounds
+ */
+gunichar
+eail_text_buffer_get_char(const EailTextBuffer *buffer, gint offset)
+{
+   if (offset < 0 || offset >= buffer->length) return '\0';
+
+   return g_utf8_get_char(eail_text_buffer_offset_to_pointer(buffer, offset));
+}
+
+/**
+ * @param buffer an EailTextBuffer
+ * @param start_offset start position
+ * @param end_offset end position, -1 for the end of the text
+ *
+ * @returns newly allocated string containing text from start_offset up to,
+ * but not including end_offset or NULL if start_offset is out of text bounds.
+ * Use g_free() to free the returned string.
+ */
+gchar *
+eail_text_buffer_get_text(const EailTextBuffer *buffer,
+                          gint start_offset,
+                          gint end_offset)
+{
+   const gchar *start, *end;
+
+   if (start_offset < 0 || start_offset >= buffer->length) return NULL;
+
+   if (end_offset < 0 || end_offset > buffer->length)
+     end_offset = buffer->length;
+   if (end_offset < start_offset)
+     end_offset = start_offset;
+
+   start = eail_text_buffer_offset_to_pointer(buffer, start_offset);
+   end = eail_text_buffer_offset_to_pointer(buffer, end_offset);
+
+   return g_strndup(start, end - start);
+}
+
+/**
+ * @brief Checks if character is a part of word
+ *
+ * @param c an unicode character
+ * @return TRUE if character belongs to word, FALSE otherwise
+ */
+static gboolean
+_eail_text_buffer_is_word_char(gunichar c)
+{
+   return g_unichar_isalnum(c) || c == '_' || c == '\'';
+}
+
+/**
+ * @brief Checks if character ends sentence
+ *
+ * @param c an unicode character
+ * @return TRUE if character terminates sentence, FALSE otherwise
+ */
+static gboolean
+_eail_text_buffer_is_sentence_end(gunichar c)
+{
+   return c == '.' || c == '!' || c == '?';
+}
+
+/**
+ * @brief Checks if character ends line
+ *
+ * @param c an unicode character
+ * @return TRUE if character is line or paragraph separator, FALSE otherwise
+ */
+static gboolean
+_eail_text_buffer_is_line_end(gunichar c)
+{
+   return c == '\n' || c == 0x2029;
+}
+
+/**
+ * @brief Stores breaks collected in array into buffer
+ *
+ * @param buffer an EailTextBuffer
+ * @param type type of breaks
+ * @param breaks GArray of gint offsets, freed by this function
+ */
+static void
+_eail_text_buffer_breaks_set(EailTextBuffer *buffer, EailTextBreakType type,
+                             GArray *breaks)
+{
+   g_free(buffer->breaks[type]);
+   buffer->n_breaks[type] = breaks->len;
+   buffer->breaks[type] = (gint *)g_array_free(breaks, FALSE);
+}
+
+/**
+ * @brief Computes word and sentence breaks in one pass over text
+ *
+ * Words are runs of alphanumeric characters. Sentence ends after '.', '!'
+ * or '?' followed by white space or end of line, next sentence starts at
+ * the first character which is not a white space.
+ *
+ * @param buffer an EailTextBuffer
+ */
+static void
+_eail_text_buffer_compute_words(EailTextBuffer *buffer)
+{
+   GArray *word_starts, *word_ends, *sentence_starts, *sentence_ends;
+   gboolean in_word = FALSE, after_terminator = FALSE, in_sentence = FALSE;
+   const gchar *p;
+   gunichar c;
+   gint i;
+
+   word_starts = g_array_new(FALSE, FALSE, sizeof(gint));
+   word_ends = g_array_new(FALSE, FALSE, sizeof(gint));
+   sentence_starts = g_array_new(FALSE, FALSE, sizeof(gint));
+   sentence_ends = g_array_new(FALSE, FALSE, sizeof(gint));
+
+   for (i = 0, p = buffer->text; i < buffer->length;
+        ++i, p = g_utf8_next_char(p))
+     {
+        gboolean word_char, space;
+
+        c = g_utf8_get_char(p);
+        word_char = _eail_text_buffer_is_word_char(c);
+        space = g_unichar_isspace(c) || _eail_text_buffer_is_line_end(c);
+
+        if (word_char && !in_word)
+          g_array_append_val(word_starts, i);
+        else if (!word_char && in_word)
+          g_array_append_val(word_ends, i);
+        in_word = word_char;
+
+        if (after_terminator && (space || !_eail_text_buffer_is_sentence_end(c)))
+          {
+             if (space)
+               {
+                  g_array_append_val(sentence_ends, i);
+                  in_sentence = FALSE;
+               }
+             after_terminator = FALSE;
+          }
+
+        if (!space && !in_sentence)
+          {
+             g_array_append_val(sentence_starts, i);
+             in_sentence = TRUE;
+          }
+
+        if (_eail_text_buffer_is_sentence_end(c))
+          after_terminator = TRUE;
+     }
+
+   if (in_word)
+     g_array_append_val(word_ends, i);
+   if (in_sentence)
+     g_array_append_val(sentence_ends, i);
+
+   _eail_text_buffer_breaks_set(buffer, EAIL_TEXT_BREAK_WORD_START,
+                                word_starts);
+   _eail_text_buffer_breaks_set(buffer, EAIL_TEXT_BREAK_WORD_END, word_ends);
+   _eail_text_buffer_breaks_set(buffer, EAIL_TEXT_BREAK_SENTENCE_START,
+                                sentence_starts);
+   _eail_text_buffer_breaks_set(buffer, EAIL_TEXT_BREAK_SENTENCE_END,
+                                sentence_ends);
+   buffer->words_valid = TRUE;
+}
+
+/**
+ * Line ends are derived from line starts: line ends before its line
+ * separator or where the next line starts when it was wrapped.
+ *
+ * @param buffer an EailTextBuffer
+ * @param starts sorted array of line start offsets, buffer takes ownership
+ * @param n_starts number of line starts
+ */
+void
+eail_text_buffer_set_line_starts(EailTextBuffer *buffer,
+                                 gint *starts,
+                                 gint n_starts)
+{
+   gint *ends;
+   gint i, end;
+
+   eail_text_buffer_drop_lines(buffer);
+
+   ends = g_new(gint, n_starts ? n_starts : 1);
+   for (i = 0; i < n_starts; ++i)
+     {
+        end = (i + 1 < n_starts) ? starts[i + 1] : buffer->length;
+        if (end > starts[i] &&
+            _eail_text_buffer_is_line_end(eail_text_buffer_get_char(buffer,
+                                                                    end - 1)))
+          end--;
+        ends[i] = end;
+     }
+
+   buffer->breaks[EAIL_TEXT_BREAK_LINE_START] = starts;
+   buffer->n_breaks[EAIL_TEXT_BREAK_LINE_START] = n_starts;
+   buffer->breaks[EAIL_TEXT_BREAK_LINE_END] = ends;
+   buffer->n_breaks[EAIL_TEXT_BREAK_LINE_END] = n_starts;
+   buffer->lines_valid = TRUE;
+}
+
+/**
+ * @param buffer an EailTextBuffer
+ */
+void
+eail_text_buffer_drop_lines(EailTextBuffer *buffer)
+{
+   g_free(buffer->breaks[EAIL_TEXT_BREAK_LINE_START]);
+   g_free(buffer->breaks[EAIL_TEXT_BREAK_LINE_END]);
+   buffer->breaks[EAIL_TEXT_BREAK_LINE_START] = NULL;
+   buffer->breaks[EAIL_TEXT_BREAK_LINE_END] = NULL;
+   buffer->n_breaks[EAIL_TEXT_BREAK_LINE_START] = 0;
+   buffer->n_breaks[EAIL_TEXT_BREAK_LINE_END] = 0;
+   buffer->lines_valid = FALSE;
+}
+
+/**
+ * @brief Computes line breaks from line separators in text
+ *
+ * Used when widget did not provide its own layout.
+ *
+ * @param buffer an EailTextBuffer
+ */
+static void
+_eail_text_buffer_compute_lines(EailTextBuffer *buffer)
+{
+   GArray *starts;
+   const gchar *p;
+   gint i = 0;
+
+   starts = g_array_new(FALSE, FALSE, sizeof(gint));
+   g_array_append_val(starts, i);
+
+   for (p = buffer->text; i < buffer->length; p = g_utf8_next_char(p))
+     {
+        ++i;
+        if (_eail_text_buffer_is_line_end(g_utf8_get_char(p)) &&
+            i < buffer->length)
+          g_array_append_val(starts, i);
+     }
+
+   i = starts->len;
+   eail_text_buffer_set_line_starts(buffer,
+                                    (gint *)g_array_free(starts, FALSE), i);
+}
+
+/**
+ * @brief Finds range between two breaks containing given offset
+ *
+ * Text before the first break and after the last one is treated as
+ * separate range.
+ *
+ * @param breaks sorted array of break offsets
+ * @param n_breaks number of breaks
+ * @param length length of text
+ * @param offset character offset
+ * @param start address of gint to put range start in
+ * @param end address of gint to put range end in
+ */
+static void
+_eail_text_buffer_range_at(const gint *breaks, gint n_breaks, gint length,
+                           gint offset, gint *start, gint *end)
+{
+   gint low = 0, high = n_breaks, middle;
+
+   /* number of breaks not greater than offset */
+   while (low < high)
+     {
+        middle = (low + high) / 2;
+        if (breaks[middle] <= offset)
+          low = middle + 1;
+        else
+          high = middle;
+     }
+
+   *start = low > 0 ? breaks[low - 1] : 0;
+   *end = low < n_breaks ? breaks[low] : length;
+}
+
+/**
+ * Breaks are computed once per buffer, so every query is a binary search.
+ *
+ * @param buffer an EailTextBuffer
+ * @param boundary type of text boundary
+ * @param offset character offset
+ * @param relation position of requested text relative to offset
+ * @param start_offset address of gint to put start offset of text in
+ * @param end_offset address of gint to put end offset of text in
+ *
+ * @returns newly allocated string, empty if there is no text at requested
+ * position. Use g_free() to free the returned string.
+ */
+gchar *
+eail_text_buffer_get_text_by_boundary(EailTextBuffer *buffer,
+                                      AtkTextBoundary boundary,
+                                      gint offset,
+                                      EailTextRelation relation,
+                                      gint *start_offset,
+                                      gint *end_offset)
+{
+   EailTextBreakType type;
+   gint start, end;
+
+   offset = CLAMP(offset, 0, buffer->length);
+
+   switch (boundary)
+     {
+      case ATK_TEXT_BOUNDARY_CHAR:
+         start = offset;
+         if (relation == EAIL_TEXT_BEFORE_OFFSET)
+           start = offset - 1;
+         else if (relation == EAIL_TEXT_AFTER_OFFSET)
+           start = offset + 1;
+         start = CLAMP(start, 0, buffer->length);
+         end = MIN(start + 1, buffer->length);
+         goto done;
+      case ATK_TEXT_BOUNDARY_WORD_START:
+         type = EAIL_TEXT_BREAK_WORD_START;
+         break;
+      case ATK_TEXT_BOUNDARY_WORD_END:
+         type = EAIL_TEXT_BREAK_WORD_END;
+         break;
+      case ATK_TEXT_BOUNDARY_SENTENCE_START:
+         type = EAIL_TEXT_BREAK_SENTENCE_START;
+         break;
+      case ATK_TEXT_BOUNDARY_SENTENCE_END:
+         type = EAIL_TEXT_BREAK_SENTENCE_END;
+         break;
+      case ATK_TEXT_BOUNDARY_LINE_START:
+         type = EAIL_TEXT_BREAK_LINE_START;
+         break;
+      case ATK_TEXT_BOUNDARY_LINE_END:
+         type = EAIL_TEXT_BREAK_LINE_END;
+         break;
+      default:
+         start = end = offset;
+         goto done;
+     }
+
+   if (type >= EAIL_TEXT_BREAK_LINE_START)
+     {
+        if (!buffer->lines_valid) _eail_text_buffer_compute_lines(buffer);
+     }
+   else if (!buffer->words_valid)
+     _eail_text_buffer_compute_words(buffer);
+
+   _eail_text_buffer_range_at(buffer->breaks[type], buffer->n_breaks[type],
+                              buffer->length, offset, &start, &end);
+
+   if (relation == EAIL_TEXT_BEFORE_OFFSET)
+     {
+        end = start;
+        if (start > 0)
+          _eail_text_buffer_range_at(buffer->breaks[type],
+                                     buffer->n_breaks[type], buffer->length,
+                                     start - 1, &start, &end);
+        end = MAX(end, start);
+     }
+   else if (relation == EAIL_TEXT_AFTER_OFFSET)
+     {
+        start = end;
+        if (end < buffer->length)
+          _eail_text_buffer_range_at(buffer->breaks[type],
+                                     buffer->n_breaks[type], buffer->length,
+                                     end, &start, &end);
+     }
+
+done:
+   if (start_offset) *start_offset = start;
+   if (end_offset) *end_offset = end;
+
+   return g_strndup(eail_text_buffer_offset_to_pointer(buffer, start),
+                    eail_text_buffer_offset_to_pointer(buffer, end) -
+                    eail_text_buffer_offset_to_pointer(buffer, start));
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_text_buffer.h
+ */
+
+#ifndef EAIL_TEXT_BUFFER_H
+#define EAIL_TEXT_BUFFER_H
+
+#include <glib.h>
+#include <atk/atk.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct _EailTextBuffer EailTextBuffer;
+typedef struct _EailTextSegment EailTextSegment;
+
+/**
+ * @brief Types of text breaks stored in EailTextBuffer
+ */
+typedef enum
+{
+   EAIL_TEXT_BREAK_WORD_START,/*!< first characters of words */
+   EAIL_TEXT_BREAK_WORD_END,/*!< offsets just after words */
+   EAIL_TEXT_BREAK_SENTENCE_START,/*!< first characters of sentences */
+   EAIL_TEXT_BREAK_SENTENCE_END,/*!< offsets just after sentences */
+   EAIL_TEXT_BREAK_LINE_START,/*!< first characters of lines */
+   EAIL_TEXT_BREAK_LINE_END,/*!< offsets of line ends */
+   EAIL_TEXT_BREAK_LAST/*!< number of break types */
+} EailTextBreakType;
+
+/**
+ * @brief Position of requested text relative to given offset
+ */
+typedef enum
+{
+   EAIL_TEXT_AT_OFFSET,/*!< text containing offset */
+   EAIL_TEXT_BEFORE_OFFSET,/*!< text just before text containing offset */
+   EAIL_TEXT_AFTER_OFFSET/*!< text just after text containing offset */
+} EailTextRelation;
+
+/**
+ * @brief Part of plain text coming from one piece of markup
+ *
+ * Segment is either literal text, copied from markup byte by byte, or
+ * result of converting single tag or escape sequence.
+ */
+struct _EailTextSegment
+{
+   gint offset;/*!< character offset of segment in plain text */
+   gint byte;/*!< byte offset of segment in plain text */
+   gint markup;/*!< byte offset of segment source in markup */
+   gboolean literal;/*!< whether segment is copied literally */
+};
+
+/**
+ * @brief Plain text of accessible with index of character offsets
+ */
+struct _EailTextBuffer
+{
+   gchar *text;/*!< plain UTF-8 text */
+   gint length;/*!< number of characters */
+   gint size;/*!< number of bytes, without terminating NUL */
+   gint *index;/*!< byte offsets of every EAIL_TEXT_BUFFER_STEP-th character,
+                 NULL if text is pure ASCII */
+   gchar *markup;/*!< markup text was converted from, NULL for plain text */
+   EailTextSegment *segments;/*!< segments of plain text, NULL if markup
+                               has no tags nor escapes */
+   gint n_segments;/*!< number of segments */
+   gint *breaks[EAIL_TEXT_BREAK_LAST];/*!< sorted offsets of text breaks,
+                                        computed on first use */
+   gint n_breaks[EAIL_TEXT_BREAK_LAST];/*!< number of text breaks */
+   gboolean words_valid;/*!< whether word and sentence breaks are computed */
+   gboolean lines_valid;/*!< whether line breaks are computed */
+};
+
+/**
+ * @brief Creates buffer holding copy of given UTF-8 text
+ */
+EailTextBuffer *eail_text_buffer_new(const gchar *text);
+
+/**
+ * @brief Creates buffer holding plain text converted from Elementary markup
+ */
+EailTextBuffer *eail_text_buffer_new_from_markup(const gchar *markup);
+
+/**
+ * @brief Gets buffer for given markup, reusing old buffer if markup did not
+ * change
+ */
+EailTextBuffer *eail_text_buffer_update(EailTextBuffer *buffer,
+                                        const gchar *markup);
+
+/**
+ * @brief Gets byte offset in markup of character at given offset
+ */
+gint eail_text_buffer_offset_to_markup(const EailTextBuffer *buffer,
+                                       gint offset);
+
+/**
+ * @brief Frees buffer
+ */
+void eail_text_buffer_free(EailTextBuffer *buffer);
+
+/**
+ * @brief Gets pointer to character at given offset
+ */
+const gchar *eail_text_buffer_offset_to_pointer(const EailTextBuffer *buffer,
+                                                gint offset);
+
+/**
+ * @brief Gets character at given offset
+ */
+gunichar eail_text_buffer_get_char(const EailTextBuffer *buffer, gint offset);
+
+/**
+ * @brief Gets copy of text between given offsets
+ */
+gchar *eail_text_buffer_get_text(const EailTextBuffer *buffer,
+                                 gint start_offset,
+                                 gint end_offset);
+
+/**
+ * @brief Sets line starts of text, as laid out by widget
+ */
+void eail_text_buffer_set_line_starts(EailTextBuffer *buffer,
+                                      gint *starts,
+                                      gint n_starts);
+
+/**
+ * @brief Drops line breaks, e.g. after text layout changed
+ */
+void eail_text_buffer_drop_lines(EailTextBuffer *buffer);
+
+/**
+ * @brief Gets text delimited by given boundary type near given offset
+ */
+gchar *eail_text_buffer_get_text_by_boundary(EailTextBuffer *buffer,
+                                             AtkTextBoundary boundary,
+                                             gint offset,
+                                             EailTextRelation relation,
+                                             gint *start_offset,
+                                             gint *end_offset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -129,10 +129,8 @@ eail_toolbar_ref_child(AtkObject *obj, gint i)
    items = eail_toolbar_get_items(EAIL_TOOLBAR(obj) );
    if (eina_list_count(items) > i)
      {
-        child = eail_item_new(obj, ATK_ROLE_MENU_ITEM);
-        atk_object_initialize(child, eina_list_nth(items, i));
-
-        g_object_ref(child);
+        child = eail_item_parent_ref_item_accessible
+           (EAIL_ITEM_PARENT(obj), eina_list_nth(items, i), ATK_ROLE_MENU_ITEM);
      }
    else
      ERR("Tried to ref child with index %d out of bounds!", i);
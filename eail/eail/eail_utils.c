@@ -35,6 +35,31 @@
 #include "eail_utils.h"
 #include "eail_priv.h"
 
+/**
+ * @brief Accessible focused in current main loop iteration, not reported yet
+ */
+static AtkObject *_eail_focus_pending = NULL;
+
+/**
+ * @brief Idle enterer reporting pending focus
+ */
+static Ecore_Idle_Enterer *_eail_focus_flusher = NULL;
+
+/**
+ * @brief Timer delaying focus report until minimal interval passes
+ */
+static Ecore_Timer *_eail_focus_timer = NULL;
+
+/**
+ * @brief Time of last focus report
+ */
+static double _eail_focus_last = 0.0;
+
+/**
+ * @brief Minimal interval between two focus reports, 0 for no limit
+ */
+static double _eail_focus_min_interval = 0.0;
+
 /**
  * @param string base string to get substring from
  * @param start_offset beginning offset
@@ -128,6 +153,9 @@ eail_evas_obj_grab_focus(Evas_Object *widget)
    ecore_evas_activate(ee);
    elm_object_focus_set(widget, EINA_TRUE);
 
+   /* focus requested by assistive technology is reported immediately */
+   eail_focus_flush();
+
    return TRUE;
 }
 
@@ -141,7 +169,157 @@ eail_widget_on_focused(void *data, Evas_Object *obj, void *event_info)
 {
    g_return_if_fail(ATK_IS_OBJECT(data));
 
-   atk_focus_tracker_notify(ATK_OBJECT(data));
+   eail_focus_notify(ATK_OBJECT(data));
+}
+
+static Eina_Bool _eail_focus_flush(void *data);
+
+/**
+ * @brief Reports pending focus to focus trackers
+ *
+ * Accessibles which widget has been deleted in the meantime are not reported.
+ */
+static void
+_eail_focus_report(void)
+{
+   AtkObject *accessible = _eail_focus_pending;
+   AtkStateSet *state_set;
+
+   _eail_focus_pending = NULL;
+   _eail_focus_last = ecore_loop_time_get();
+
+   state_set = atk_object_ref_state_set(accessible);
+   if (!atk_state_set_contains_state(state_set, ATK_STATE_DEFUNCT))
+     atk_focus_tracker_notify(accessible);
+
+   g_object_unref(state_set);
+   g_object_unref(accessible);
+}
+
+/**
+ * @brief Wakes up focus flusher after minimal interval has passed
+ *
+ * @param data not used
+ * @return ECORE_CALLBACK_CANCEL
+ */
+static Eina_Bool
+_eail_focus_on_timer(void *data)
+{
+   _eail_focus_timer = NULL;
+
+   if (_eail_focus_pending && !_eail_focus_flusher)
+     _eail_focus_flusher = ecore_idle_enterer_add(_eail_focus_flush, NULL);
+
+   return ECORE_CALLBACK_CANCEL;
+}
+
+/**
+ * @brief Reports accessible focused as last one to focus trackers
+ *
+ * @param data not used
+ * @return ECORE_CALLBACK_CANCEL
+ */
+static Eina_Bool
+_eail_focus_flush(void *data)
+{
+   double now = ecore_loop_time_get();
+
+   _eail_focus_flusher = NULL;
+
+   if (!_eail_focus_pending) return ECORE_CALLBACK_CANCEL;
+
+   if (_eail_focus_min_interval > 0.0 &&
+       now - _eail_focus_last < _eail_focus_min_interval)
+     {
+        if (!_eail_focus_timer)
+          _eail_focus_timer =
+             ecore_timer_add(_eail_focus_last + _eail_focus_min_interval - now,
+                             _eail_focus_on_timer, NULL);
+        return ECORE_CALLBACK_CANCEL;
+     }
+
+   _eail_focus_report();
+
+   return ECORE_CALLBACK_CANCEL;
+}
+
+/**
+ * Focus trackers are notified once per main loop iteration about the
+ * accessible focused as the last one, so focus jumping through many widgets
+ * in one iteration costs a single notification.
+ *
+ * @param accessible focused AtkObject
+ */
+void
+eail_focus_notify(AtkObject *accessible)
+{
+   g_return_if_fail(ATK_IS_OBJECT(accessible));
+
+   g_object_ref(accessible);
+   if (_eail_focus_pending)
+     g_object_unref(_eail_focus_pending);
+   _eail_focus_pending = accessible;
+
+   if (!_eail_focus_flusher && !_eail_focus_timer)
+     _eail_focus_flusher = ecore_idle_enterer_add(_eail_focus_flush, NULL);
+}
+
+/**
+ * Pending focus is reported right away, regardless of minimal interval.
+ */
+void
+eail_focus_flush(void)
+{
+   if (_eail_focus_flusher)
+     {
+        ecore_idle_enterer_del(_eail_focus_flusher);
+        _eail_focus_flusher = NULL;
+     }
+
+   if (_eail_focus_timer)
+     {
+        ecore_timer_del(_eail_focus_timer);
+        _eail_focus_timer = NULL;
+     }
+
+   if (_eail_focus_pending)
+     _eail_focus_report();
+}
+
+/**
+ * @param interval minimal time in seconds between two focus notifications,
+ * 0 to report focus on every main loop iteration
+ */
+void
+eail_focus_min_interval_set(double interval)
+{
+   _eail_focus_min_interval = interval;
+}
+
+/**
+ * Drops pending focus notification. Should be called when EAIL module is
+ * unloaded.
+ */
+void
+eail_focus_shutdown(void)
+{
+   if (_eail_focus_flusher)
+     {
+        ecore_idle_enterer_del(_eail_focus_flusher);
+        _eail_focus_flusher = NULL;
+     }
+
+   if (_eail_focus_timer)
+     {
+        ecore_timer_del(_eail_focus_timer);
+        _eail_focus_timer = NULL;
+     }
+
+   if (_eail_focus_pending)
+     {
+        g_object_unref(_eail_focus_pending);
+        _eail_focus_pending = NULL;
+     }
 }
 
 /**
@@ -175,6 +353,188 @@ eail_get_coords_widget_center(Evas_Object *widget, int *x, int *y)
    *y = *y + (h / 2);
 }
 
+/**
+ * @param item an Elm_Object_Item
+ *
+ * @returns Evas_Object representing item on screen, NULL if item has no
+ * view, e.g. genlist item which is not realized
+ */
+Evas_Object *
+eail_item_get_view(Elm_Object_Item *item)
+{
+   if (!item) return NULL;
+
+   return VIEW(item);
+}
+
+/**
+ * @brief Deletion hooks of item chained by eail_item_del_watch
+ */
+typedef struct _Eail_Item_Watch Eail_Item_Watch;
+
+struct _Eail_Item_Watch
+{
+   Elm_Widget_Item *item;/*!< watched item */
+   Evas_Smart_Cb del_func;/*!< deletion callback set by application */
+   Elm_Widget_Del_Pre_Cb del_pre_func;/*!< deletion hook set by widget */
+   Eail_Item_Del_Cb func;/*!< callback called when item is deleted */
+};
+
+/**
+ * @brief Elm_Object_Item* to Eail_Item_Watch* of all watched items
+ */
+static Eina_Hash *_eail_item_watches = NULL;
+
+static void _eail_item_watch_on_del(void *data, Evas_Object *obj,
+                                    void *event_info);
+static Eina_Bool _eail_item_watch_on_del_pre(void *data);
+
+/**
+ * @brief Restores deletion hooks of watched item and stops watching it
+ *
+ * @param watch an Eail_Item_Watch
+ */
+static void
+_eail_item_watch_drop(Eail_Item_Watch *watch)
+{
+   Elm_Widget_Item *it = watch->item;
+
+   if (it->del_func == _eail_item_watch_on_del)
+     it->del_func = watch->del_func;
+   if (it->del_pre_func == _eail_item_watch_on_del_pre)
+     it->del_pre_func = watch->del_pre_func;
+
+   eina_hash_del_by_key(_eail_item_watches, &it);
+}
+
+/**
+ * @brief Deletion callback of watched item, called whenever item is freed
+ *
+ * @param data data of deleted item
+ * @param obj item widget
+ * @param event_info deleted Elm_Object_Item
+ */
+static void
+_eail_item_watch_on_del(void *data, Evas_Object *obj, void *event_info)
+{
+   Eail_Item_Watch *watch;
+   Evas_Smart_Cb del_func;
+   Eail_Item_Del_Cb func;
+
+   watch = eina_hash_find(_eail_item_watches, &event_info);
+   if (!watch) return;
+
+   del_func = watch->del_func;
+   func = watch->func;
+   _eail_item_watch_drop(watch);
+
+   func(event_info, obj);
+   if (del_func)
+     del_func(data, obj, event_info);
+}
+
+/**
+ * @brief Pre-deletion hook of watched item, called by elm_object_item_del
+ *
+ * Unlike deletion callback it can not be replaced by application.
+ *
+ * @param data deleted Elm_Widget_Item
+ * @return result of hook set by widget, EINA_TRUE if item may be freed
+ */
+static Eina_Bool
+_eail_item_watch_on_del_pre(void *data)
+{
+   Elm_Widget_Item *it = data;
+   Eail_Item_Watch *watch;
+   Elm_Widget_Del_Pre_Cb del_pre_func;
+   Eail_Item_Del_Cb func;
+
+   watch = eina_hash_find(_eail_item_watches, &it);
+   if (!watch) return EINA_TRUE;
+
+   del_pre_func = watch->del_pre_func;
+   func = watch->func;
+   _eail_item_watch_drop(watch);
+
+   func((Elm_Object_Item *)it, it->widget);
+
+   return del_pre_func ? del_pre_func(data) : EINA_TRUE;
+}
+
+/**
+ * Deletion is tracked both with deletion callback of item, called however
+ * item is freed, and with its pre-deletion hook, which application can not
+ * replace. Hooks set before are chained and restored when item is deleted.
+ * Watching item again installs hooks replaced meanwhile, func is called
+ * once.
+ *
+ * @param item an Elm_Object_Item
+ * @param func callback called when item is deleted
+ */
+void
+eail_item_del_watch(Elm_Object_Item *item, Eail_Item_Del_Cb func)
+{
+   Elm_Widget_Item *it = (Elm_Widget_Item *)item;
+   Eail_Item_Watch *watch;
+
+   if (!it || !func) return;
+
+   if (!_eail_item_watches)
+     _eail_item_watches = eina_hash_pointer_new(free);
+
+   watch = eina_hash_find(_eail_item_watches, &it);
+   if (!watch)
+     {
+        watch = calloc(1, sizeof(Eail_Item_Watch));
+        if (!watch) return;
+
+        watch->item = it;
+        eina_hash_add(_eail_item_watches, &it, watch);
+     }
+   watch->func = func;
+
+   if (it->del_func != _eail_item_watch_on_del)
+     {
+        watch->del_func = it->del_func;
+        it->del_func = _eail_item_watch_on_del;
+     }
+   if (it->del_pre_func != _eail_item_watch_on_del_pre)
+     {
+        watch->del_pre_func = it->del_pre_func;
+        it->del_pre_func = _eail_item_watch_on_del_pre;
+     }
+}
+
+/**
+ * @brief Collects watches, called for each watch on shutdown
+ */
+static Eina_Bool
+_eail_item_watch_collect_cb(const Eina_Hash *hash, const void *key,
+                            void *data, void *fdata)
+{
+   *(Eina_List **)fdata = eina_list_append(*(Eina_List **)fdata, data);
+
+   return EINA_TRUE;
+}
+
+void
+eail_item_del_watch_shutdown(void)
+{
+   Eina_List *watches = NULL;
+   Eail_Item_Watch *watch;
+
+   if (!_eail_item_watches) return;
+
+   /* watches can not be removed while iterating over hash */
+   eina_hash_foreach(_eail_item_watches, _eail_item_watch_collect_cb,
+                     &watches);
+   EINA_LIST_FREE(watches, watch)
+     _eail_item_watch_drop(watch);
+
+   eina_hash_free(_eail_item_watches);
+   _eail_item_watches = NULL;
+}
+
 static Eina_List *
 _eail_get_evas_obj_list_from_item(Elm_Object_Item *item)
 {
@@ -236,19 +596,72 @@ eail_get_edje_parts_for_item(Elm_Object_Item *item)
 {
    Eina_List *edje_parts = NULL;
    Eina_List *usable_parts = NULL;
-   int i = 0;
+   Evas_Object *obj;
 
    edje_parts = _eail_get_evas_obj_list_from_item(item);
-   for (i = 0; i < eina_list_count(edje_parts); ++i)
+   EINA_LIST_FREE(edje_parts, obj)
      {
-        Evas_Object *obj = eina_list_nth(edje_parts, i);
-
         /* adding only parts that can be used by eail_factory later */
         if (elm_object_widget_check(obj))
           usable_parts = eina_list_append(usable_parts, obj);
      }
 
-   eina_list_free(edje_parts);
-
    return usable_parts;
 }
+
+/**
+ * @brief Appends integer attribute to attribute set
+ *
+ * @param attributes an AtkAttributeSet
+ * @param name attribute name
+ * @param value attribute value
+ *
+ * @returns attribute set with appended attribute
+ */
+static AtkAttributeSet *
+_eail_attributes_append_int(AtkAttributeSet *attributes, const gchar *name,
+                            gint value)
+{
+   AtkAttribute *attr = g_new(AtkAttribute, 1);
+
+   attr->name = g_strdup(name);
+   attr->value = g_strdup_printf("%d", value);
+
+   return g_slist_append(attributes, attr);
+}
+
+/**
+ * Nothing is appended if parent of cell does not implement AtkTable or does
+ * not place cell anywhere. Table lookups of EAIL containers are indexed,
+ * so it takes constant time.
+ *
+ * @param attributes an AtkAttributeSet to append to
+ * @param cell an AtkObject
+ *
+ * @returns attribute set with cell attributes appended
+ */
+AtkAttributeSet *
+eail_table_cell_attributes_append(AtkAttributeSet *attributes, AtkObject *cell)
+{
+   AtkObject *parent = atk_object_get_parent(cell);
+   gint index, row, column;
+
+   if (!ATK_IS_TABLE(parent)) return attributes;
+
+   index = atk_object_get_index_in_parent(cell);
+   row = atk_table_get_row_at_index(ATK_TABLE(parent), index);
+   column = atk_table_get_column_at_index(ATK_TABLE(parent), index);
+   if (row < 0 || column < 0) return attributes;
+
+   attributes = _eail_attributes_append_int(attributes, "table-cell-row", row);
+   attributes = _eail_attributes_append_int(attributes, "table-cell-column",
+                                            column);
+   attributes = _eail_attributes_append_int
+      (attributes, "table-cell-row-span",
+       atk_table_get_row_extent_at(ATK_TABLE(parent), row, column));
+   attributes = _eail_attributes_append_int
+      (attributes, "table-cell-column-span",
+       atk_table_get_column_extent_at(ATK_TABLE(parent), row, column));
+
+   return attributes;
+}
@@ -51,6 +51,26 @@ void eail_widget_on_focused(void *data,
                             Evas_Object *obj,
                             void *event_info);
 
+/**
+ * @brief Schedules focus notification for given accessible
+ */
+void eail_focus_notify(AtkObject *accessible);
+
+/**
+ * @brief Reports pending focus notification immediately
+ */
+void eail_focus_flush(void);
+
+/**
+ * @brief Sets minimal interval between focus notifications
+ */
+void eail_focus_min_interval_set(double interval);
+
+/**
+ * @brief Drops pending focus notification
+ */
+void eail_focus_shutdown(void);
+
 /**
  * @brief Emulates mouse 'click' event at given coordinates
  */
@@ -61,6 +81,28 @@ void eail_mouse_click_on_coords(Evas_Object *widget, int x, int y);
  */
 void eail_get_coords_widget_center(Evas_Object *widget, int *x, int *y);
 
+/**
+ * @brief Gets view object of item, NULL if item is not realized
+ */
+Evas_Object *eail_item_get_view(Elm_Object_Item *item);
+
+/**
+ * @brief Callback called when watched item is deleted
+ *
+ * Item is being freed, so only its address and widget may be used.
+ */
+typedef void (*Eail_Item_Del_Cb)(Elm_Object_Item *item, Evas_Object *widget);
+
+/**
+ * @brief Calls func when item is deleted
+ */
+void eail_item_del_watch(Elm_Object_Item *item, Eail_Item_Del_Cb func);
+
+/**
+ * @brief Stops watching all items, restoring their deletion callbacks
+ */
+void eail_item_del_watch_shutdown(void);
+
 /**
  * @brief Gets edje parts list for item
  *
@@ -72,6 +114,13 @@ Eina_List *eail_get_edje_parts_for_item(Elm_Object_Item *item);
  * as const gchar*)
  */
 Eina_List *eail_item_get_content_strings(Elm_Object_Item *item);
+
+/**
+ * @brief Appends row, column and spans of accessible placed in AtkTable to
+ * its attributes
+ */
+AtkAttributeSet *eail_table_cell_attributes_append(AtkAttributeSet *attributes,
+                                                   AtkObject *cell);
 #ifdef __cplusplus
 }
 #endif
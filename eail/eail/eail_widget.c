@@ -27,7 +27,9 @@
 #include <Elementary.h>
 
 #include "eail_widget.h"
+#include "eail_item_parent.h"
 #include "eail_factory.h"
+#include "eail_events.h"
 #include "eail_utils.h"
 #include "eail_priv.h"
 
@@ -45,6 +47,18 @@ G_DEFINE_TYPE_WITH_CODE(EailWidget, eail_widget, ATK_TYPE_OBJECT,
  */
 #define EAIL_WIDGET_FOCUS_NAME "focused"
 
+/**
+ * @brief Smart signals emitted when children are added to or removed from
+ * widget
+ */
+#define EAIL_WIDGET_SUB_OBJECT_ADD_NAME "sub-object-add"
+#define EAIL_WIDGET_SUB_OBJECT_DEL_NAME "sub-object-del"
+#define EAIL_WIDGET_CHILD_ADDED_NAME "child,added"
+#define EAIL_WIDGET_CHILD_REMOVED_NAME "child,removed"
+
+static void eail_widget_on_child_del(void *data, Evas *e,
+                                     Evas_Object *obj, void *event_info);
+
 /*
  * Public API implementation
  */
@@ -80,6 +94,306 @@ eail_widget_get_widget_children(EailWidget *widget)
     return klass->get_widget_children(widget);
 }
 
+/**
+ * @brief Stops tracking children stored in given array
+ *
+ * @param widget an EailWidget
+ * @param children array of Evas_Object* children
+ */
+static void
+eail_widget_untrack_children(EailWidget *widget, Eina_Array *children)
+{
+    Evas_Object *child;
+    Eina_Array_Iterator it;
+    unsigned int i;
+
+    EINA_ARRAY_ITER_NEXT(children, i, child, it) {
+        evas_object_event_callback_del_full(child, EVAS_CALLBACK_DEL,
+                                            eail_widget_on_child_del, widget);
+    }
+}
+
+/**
+ * @brief Drops cached children of widget
+ *
+ * Children will be fetched again with get_widget_children on next request.
+ *
+ * @param widget an EailWidget
+ */
+void
+eail_widget_invalidate_children(EailWidget *widget)
+{
+    g_return_if_fail(EAIL_IS_WIDGET(widget));
+
+    if (!widget->children) {
+        return;
+    }
+
+    eail_widget_untrack_children(widget, widget->children);
+
+    eina_array_free(widget->children);
+    eina_hash_free(widget->children_index);
+    widget->children = NULL;
+    widget->children_index = NULL;
+}
+
+/**
+ * @brief Fills children cache of widget
+ *
+ * @param widget an EailWidget
+ */
+static void
+eail_widget_fill_children(EailWidget *widget)
+{
+    Eina_List *children, *l;
+    Evas_Object *child;
+
+    widget->children = eina_array_new(8);
+    widget->children_index = eina_hash_pointer_new(NULL);
+    widget->children_serial++;
+
+    children = eail_widget_get_widget_children(widget);
+    EINA_LIST_FOREACH(children, l, child) {
+        if (eina_hash_find(widget->children_index, &child)) {
+            continue;
+        }
+
+        eina_array_push(widget->children, child);
+        /* index is stored increased by one to distinguish it from NULL */
+        eina_hash_add(widget->children_index, &child,
+                      GINT_TO_POINTER(eina_array_count(widget->children)));
+        evas_object_event_callback_add(child, EVAS_CALLBACK_DEL,
+                                       eail_widget_on_child_del, widget);
+    }
+
+    eina_list_free(children);
+}
+
+/**
+ * @brief Gets cached children of widget, fetching them if needed
+ *
+ * Pending refresh of children is done right away, so changes made in this
+ * main loop iteration are visible. Array stays valid until children change,
+ * which can be detected by children_serial of widget.
+ *
+ * @param widget an EailWidget
+ * @return array of Evas_Object* children owned by widget
+ */
+Eina_Array *
+eail_widget_get_cached_children(EailWidget *widget)
+{
+    g_return_val_if_fail(EAIL_IS_WIDGET(widget), NULL);
+
+    if (widget->children_refresh) {
+        eail_widget_refresh_children(widget);
+    }
+
+    if (!widget->children) {
+        eail_widget_fill_children(widget);
+    }
+
+    return widget->children;
+}
+
+/**
+ * @brief Fetches children of widget again and reports the differences
+ *
+ * Nothing is done if children were not requested yet, as nobody can be
+ * interested in changes then.
+ *
+ * @param widget an EailWidget
+ */
+void
+eail_widget_refresh_children(EailWidget *widget)
+{
+    Eina_Array *old_children;
+    Eina_Hash *old_index;
+    Evas_Object *child;
+    unsigned int i;
+
+    g_return_if_fail(EAIL_IS_WIDGET(widget));
+
+    if (widget->children_refresh) {
+        ecore_idle_enterer_del(widget->children_refresh);
+        widget->children_refresh = NULL;
+    }
+
+    if (!widget->children) {
+        return;
+    }
+
+    old_children = widget->children;
+    old_index = widget->children_index;
+    eail_widget_untrack_children(widget, old_children);
+
+    eail_widget_fill_children(widget);
+
+    for (i = eina_array_count(old_children); i > 0; --i) {
+        child = eina_array_data_get(old_children, i - 1);
+        if (!eina_hash_find(widget->children_index, &child)) {
+            eail_events_children_changed(ATK_OBJECT(widget), FALSE, i - 1,
+                                         eail_factory_find_accessible(child));
+        }
+    }
+
+    for (i = 0; i < eina_array_count(widget->children); ++i) {
+        child = eina_array_data_get(widget->children, i);
+        if (!eina_hash_find(old_index, &child)) {
+            eail_events_children_changed(ATK_OBJECT(widget), TRUE, i,
+                                         eail_factory_get_accessible(child));
+        }
+    }
+
+    eina_array_free(old_children);
+    eina_hash_free(old_index);
+}
+
+/**
+ * @brief Gets index of child in cached children of widget
+ *
+ * @param widget an EailWidget
+ * @param child an Evas_Object
+ * @return child index or -1 if child was not found
+ */
+static gint
+eail_widget_get_cached_child_index(EailWidget *widget, Evas_Object *child)
+{
+    gpointer index;
+
+    eail_widget_get_cached_children(widget);
+
+    index = eina_hash_find(widget->children_index, &child);
+    if (!index) {
+        return -1;
+    }
+
+    return GPOINTER_TO_INT(index) - 1;
+}
+
+/**
+ * @brief Callback used to drop children cache when one of children dies
+ *
+ * @param data an EailWidget
+ * @param e an Evas
+ * @param obj deleted child
+ * @param event_info additional event info (not used here)
+ */
+static void
+eail_widget_on_child_del(void *data, Evas *e,
+                         Evas_Object *obj, void *event_info)
+{
+    EailWidget *widget = EAIL_WIDGET(data);
+    gint index = eail_widget_get_cached_child_index(widget, obj);
+
+    eail_widget_invalidate_children(widget);
+
+    if (index >= 0) {
+        eail_events_children_changed(ATK_OBJECT(widget), FALSE, index,
+                                     eail_factory_find_accessible(obj));
+    }
+}
+
+/**
+ * @brief Idle enterer refreshing children of widget
+ *
+ * @param data an EailWidget
+ * @return ECORE_CALLBACK_CANCEL
+ */
+static Eina_Bool
+eail_widget_on_children_refresh(void *data)
+{
+    EailWidget *widget = EAIL_WIDGET(data);
+
+    widget->children_refresh = NULL;
+    eail_widget_refresh_children(widget);
+
+    return ECORE_CALLBACK_CANCEL;
+}
+
+/**
+ * @brief Schedules refresh of widget children
+ *
+ * Children are fetched again once per main loop iteration, after all
+ * children added or removed in it, or earlier when they are requested.
+ * Nothing is done if children were not requested yet.
+ *
+ * @param widget an EailWidget
+ */
+void
+eail_widget_children_changed(EailWidget *widget)
+{
+    g_return_if_fail(EAIL_IS_WIDGET(widget));
+
+    if (!widget->children || widget->children_refresh) {
+        return;
+    }
+
+    widget->children_refresh =
+        ecore_idle_enterer_add(eail_widget_on_children_refresh, widget);
+}
+
+/**
+ * @brief Callback for sub-object added to widget
+ *
+ * Only sub-objects that are widgets can be children of widget.
+ *
+ * @param data an EailWidget
+ * @param obj widget that emitted signal
+ * @param event_info added sub-object
+ */
+static void
+eail_widget_on_sub_object_add(void *data, Evas_Object *obj, void *event_info)
+{
+    Evas_Object *sub_object = event_info;
+
+    if (!sub_object || !elm_object_widget_check(sub_object)) {
+        return;
+    }
+
+    eail_widget_children_changed(EAIL_WIDGET(data));
+}
+
+/**
+ * @brief Callback for child or sub-object added to or removed from widget
+ *
+ * @param data an EailWidget
+ * @param obj widget that emitted signal
+ * @param event_info additional event info (not used here)
+ */
+static void
+eail_widget_on_child_changed(void *data, Evas_Object *obj, void *event_info)
+{
+    eail_widget_children_changed(EAIL_WIDGET(data));
+}
+
+/**
+ * @brief Registers callbacks that keep children cache up to date and report
+ * changes of children
+ *
+ * Elementary containers add packed content as their sub-object and remove
+ * it when it is unpacked, some widgets also emit child signals. Frequent
+ * signals, like "changed" or size hints changes, are not tracked as they do
+ * not change children.
+ *
+ * @param widget an EailWidget
+ */
+static void
+eail_widget_track_children(EailWidget *widget)
+{
+    evas_object_smart_callback_add(widget->widget,
+                                   EAIL_WIDGET_SUB_OBJECT_ADD_NAME,
+                                   eail_widget_on_sub_object_add, widget);
+    evas_object_smart_callback_add(widget->widget,
+                                   EAIL_WIDGET_SUB_OBJECT_DEL_NAME,
+                                   eail_widget_on_child_changed, widget);
+    evas_object_smart_callback_add(widget->widget,
+                                   EAIL_WIDGET_CHILD_ADDED_NAME,
+                                   eail_widget_on_child_changed, widget);
+    evas_object_smart_callback_add(widget->widget,
+                                   EAIL_WIDGET_CHILD_REMOVED_NAME,
+                                   eail_widget_on_child_changed, widget);
+}
+
 /*
  * Implementation of the *AtkObject* interface
  */
@@ -110,6 +424,8 @@ eail_widget_initialize(AtkObject *obj, gpointer data)
 
     evas_object_smart_callback_add(widget->widget, EAIL_WIDGET_FOCUS_NAME,
                                    eail_widget_on_focused, widget);
+    eail_widget_track_children(widget);
+    eail_events_track_widget(obj, widget->widget);
 }
 
 /**
@@ -132,15 +448,11 @@ eail_widget_get_real_widget_children(EailWidget *widget)
 static gint
 eail_widget_get_n_children(AtkObject *obj)
 {
-    gint n_children;
-    Eina_List *children;
-
-    children = eail_widget_get_widget_children(EAIL_WIDGET(obj));
-    n_children = eina_list_count(children);
+    Eina_Array *children;
 
-    eina_list_free(children);
+    children = eail_widget_get_cached_children(EAIL_WIDGET(obj));
 
-    return n_children;
+    return eina_array_count(children);
 }
 
 /**
@@ -155,17 +467,15 @@ eail_widget_get_n_children(AtkObject *obj)
 static AtkObject *
 eail_widget_ref_child(AtkObject *obj, gint i)
 {
-    Eina_List *children;
+    Eina_Array *children;
     AtkObject *child = NULL;
 
-    children = eail_widget_get_widget_children(EAIL_WIDGET(obj));
-    if (eina_list_count(children) > i) {
-        child = eail_factory_get_accessible(eina_list_nth(children, i));
-        g_object_ref(child);
+    children = eail_widget_get_cached_children(EAIL_WIDGET(obj));
+    if (i >= 0 && eina_array_count(children) > i) {
+        child = eail_factory_get_accessible(eina_array_data_get(children, i));
+        if (child) g_object_ref(child);
     }
 
-    eina_list_free(children);
-
     return child;
 }
 
@@ -202,10 +512,7 @@ eail_widget_get_parent(AtkObject *obj)
 static gint
 eail_widget_get_index_in_parent(AtkObject *obj)
 {
-    gint index;
-    Eina_List *l, *children;
     AtkObject *parent;
-    Evas_Object *child;
     Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(obj));
 
     if (!widget) {
@@ -219,22 +526,11 @@ eail_widget_get_index_in_parent(AtkObject *obj)
         parent = atk_object_get_parent(obj);
     }
 
-    if (!parent) {
+    if (!parent || !EAIL_IS_WIDGET(parent)) {
         return -1;
     }
 
-    index = -1;
-    children = eail_widget_get_widget_children(EAIL_WIDGET(parent));
-    EINA_LIST_FOREACH(children, l, child) {
-        ++index;
-        if (child == widget) {
-            break;
-        }
-    }
-
-    eina_list_free(children);
-
-    return index;
+    return eail_widget_get_cached_child_index(EAIL_WIDGET(parent), widget);
 }
 
 /**
@@ -277,7 +573,7 @@ eail_widget_get_attributes(AtkObject *obj)
 
     attributes = g_slist_append(NULL, attr);
 
-    return attributes;
+    return eail_table_cell_attributes_append(attributes, obj);
 }
 
 /**
@@ -300,6 +596,13 @@ eail_widget_init(EailWidget *widget)
 static void
 eail_widget_class_finalize(GObject *obj)
 {
+    EailWidget *widget = EAIL_WIDGET(obj);
+
+    if (widget->children_refresh) {
+        ecore_idle_enterer_del(widget->children_refresh);
+    }
+    eail_widget_invalidate_children(widget);
+
     G_OBJECT_CLASS(eail_widget_parent_class)->finalize(obj);
 }
 
@@ -502,6 +805,145 @@ eail_widget_set_extents(AtkComponent  *component,
     return TRUE;
 }
 
+/**
+ * @brief Translates coordinates to canvas coordinates of widget
+ *
+ * @param widget an Evas_Object
+ * @param x address of x coordinate to translate
+ * @param y address of y coordinate to translate
+ * @param coord_type type of given coordinates
+ */
+static void
+eail_widget_to_canvas_coords(Evas_Object  *widget,
+                             gint         *x,
+                             gint         *y,
+                             AtkCoordType  coord_type)
+{
+    if (coord_type == ATK_XY_SCREEN) {
+        int ee_x, ee_y;
+        Ecore_Evas *ee= ecore_evas_ecore_evas_get(evas_object_evas_get(widget));
+
+        ecore_evas_geometry_get(ee, &ee_x, &ee_y, NULL, NULL);
+        *x -= ee_x;
+        *y -= ee_y;
+    }
+}
+
+/**
+ * @brief Checks if the point is within the extent of the component
+ *
+ * @param component an AtkComponent
+ * @param x x coordinate
+ * @param y y coordinate
+ * @param coord_type coordinates type
+ * @return TRUE if point is within component, FALSE otherwise
+ */
+static gboolean
+eail_widget_contains(AtkComponent *component,
+                     gint          x,
+                     gint          y,
+                     AtkCoordType  coord_type)
+{
+    Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(component));
+    int wx, wy, width, height;
+
+    if (!widget) {
+        return FALSE;
+    }
+
+    eail_widget_to_canvas_coords(widget, &x, &y, coord_type);
+    evas_object_geometry_get(widget, &wx, &wy, &width, &height);
+
+    return x >= wx && y >= wy && x < wx + width && y < wy + height;
+}
+
+/**
+ * @brief Gets reference to the child placed at given point
+ *
+ * Evas is asked for objects under the point, top-most first. Smart parent
+ * chain of each of them is walked up until one of cached children is met,
+ * so the lookup does not depend on the number of children. Item containers
+ * look up their items with EailItemParent. Widgets exposing children in their
+ * own way get their children checked one by one.
+ *
+ * @param component an AtkComponent
+ * @param x x coordinate
+ * @param y y coordinate
+ * @param coord_type coordinates type
+ * @return AtkObject* child at point or NULL, reference should be released
+ * with g_object_unref
+ */
+static AtkObject *
+eail_widget_ref_accessible_at_point(AtkComponent *component,
+                                    gint          x,
+                                    gint          y,
+                                    AtkCoordType  coord_type)
+{
+    EailWidget *eail_widget = EAIL_WIDGET(component);
+    Evas_Object *widget = eail_widget_get_widget(eail_widget);
+    Evas_Object *found = NULL, *obj;
+    Eina_List *objects;
+    AtkObject *child;
+    gint i, n;
+
+    if (!eail_widget_contains(component, x, y, coord_type)) {
+        return NULL;
+    }
+
+    if (EAIL_IS_ITEM_PARENT(component)) {
+        return eail_item_parent_ref_item_at_point(EAIL_ITEM_PARENT(component),
+                                                  x, y, coord_type);
+    }
+
+    if (ATK_OBJECT_GET_CLASS(component)->ref_child != eail_widget_ref_child) {
+        n = atk_object_get_n_children(ATK_OBJECT(component));
+        for (i = n - 1; i >= 0; --i) {
+            child = atk_object_ref_accessible_child(ATK_OBJECT(component), i);
+            if (!child) {
+                continue;
+            }
+
+            if (ATK_IS_COMPONENT(child) &&
+                atk_component_contains(ATK_COMPONENT(child), x, y,
+                                       coord_type)) {
+                return child;
+            }
+
+            g_object_unref(child);
+        }
+
+        return NULL;
+    }
+
+    if (!eina_array_count(eail_widget_get_cached_children(eail_widget))) {
+        return NULL;
+    }
+
+    eail_widget_to_canvas_coords(widget, &x, &y, coord_type);
+    objects = evas_tree_objects_at_xy_get(evas_object_evas_get(widget),
+                                          NULL, x, y);
+
+    EINA_LIST_FREE(objects, obj) {
+        for (; obj && !found && obj != widget;
+             obj = evas_object_smart_parent_get(obj)) {
+            if (eail_widget_get_cached_child_index(eail_widget, obj) >= 0) {
+                found = obj;
+            }
+        }
+    }
+
+    if (!found) {
+        return NULL;
+    }
+
+    child = eail_factory_get_accessible(found);
+    if (!child) {
+        return NULL;
+    }
+
+    return g_object_ref(child);
+}
+
 /**
  * @brief AktComponent interface initializer
  *
@@ -516,4 +958,6 @@ atk_component_interface_init(AtkComponentIface *iface)
     iface->set_position = eail_widget_set_position;
     iface->set_size = eail_widget_set_size;
     iface->set_extents = eail_widget_set_extents;
+    iface->contains = eail_widget_contains;
+    iface->ref_accessible_at_point = eail_widget_ref_accessible_at_point;
 }
@@ -27,6 +27,7 @@
 #include <atk/atk.h>
 
 #include <Eina.h>
+#include <Ecore.h>
 #include <Evas.h>
 
 #define EAIL_TYPE_WIDGET              (eail_widget_get_type())
@@ -53,6 +54,13 @@ struct _EailWidget
 
    Evas_Object *widget;
    AtkLayer layer;
+
+   Eina_Array *children;/*!< cached children, NULL if not fetched yet */
+   Eina_Hash *children_index;/*!< child Evas_Object* to its index + 1 */
+   unsigned int children_serial;/*!< bumped every time children are
+                                  fetched */
+   Ecore_Idle_Enterer *children_refresh;/*!< pending refresh of children,
+                                          NULL if they are up to date */
 };
 
 struct _EailWidgetClass
@@ -65,6 +73,10 @@ struct _EailWidgetClass
 GType           eail_widget_get_type              (void);
 Evas_Object *   eail_widget_get_widget            (EailWidget *widget);
 Eina_List *     eail_widget_get_widget_children   (EailWidget *widget);
+Eina_Array *    eail_widget_get_cached_children   (EailWidget *widget);
+void            eail_widget_invalidate_children   (EailWidget *widget);
+void            eail_widget_refresh_children      (EailWidget *widget);
+void            eail_widget_children_changed      (EailWidget *widget);
 
 #ifdef __cplusplus
 }
@@ -27,13 +27,28 @@
 #include "eail_utils.h"
 #include "eail_priv.h"
 
-static void eail_window_actions_init(EailActionWidget *widget);
+static void eail_window_actions_init(EailWindowClass *klass);
+static void eail_window_on_sub_widget_del(void *data, Evas *e,
+                                          Evas_Object *obj, void *event_info);
+static void eail_window_on_sub_widget_hints(void *data, Evas *e,
+                                            Evas_Object *obj,
+                                            void *event_info);
+static void eail_window_on_sub_object_add(void *data, Evas_Object *obj,
+                                          void *event_info);
+static void eail_window_on_sub_object_del(void *data, Evas_Object *obj,
+                                          void *event_info);
 
 /**
  * @brief Focus signal name
  */
 #define EAIL_WINDOW_FOCUS_NAME "focus,in"
 
+/**
+ * @brief Smart signals emitted by window when its sub-objects change
+ */
+#define EAIL_WINDOW_SUB_OBJECT_ADD_NAME "sub-object-add"
+#define EAIL_WINDOW_SUB_OBJECT_DEL_NAME "sub-object-del"
+
 #define EAIL_WIN_ACTION_MAXIMIZE "maximize"
 #define EAIL_WIN_ACTION_MINIMIZE "minimize"
 
@@ -81,7 +96,13 @@ eail_window_initialize(AtkObject *obj, gpointer data)
    obj->role = ATK_ROLE_WINDOW;
 
    eail_window_init_focus_handler(obj);
-   eail_window_actions_init(EAIL_ACTION_WIDGET(obj));
+
+   evas_object_smart_callback_add((Evas_Object *)data,
+                                  EAIL_WINDOW_SUB_OBJECT_ADD_NAME,
+                                  eail_window_on_sub_object_add, obj);
+   evas_object_smart_callback_add((Evas_Object *)data,
+                                  EAIL_WINDOW_SUB_OBJECT_DEL_NAME,
+                                  eail_window_on_sub_object_del, obj);
 }
 
 /**
@@ -118,13 +139,17 @@ _parse_edje(const Evas_Object *edje)
 }
 
 /**
- * @brief Gets widget children
+ * @brief Scans canvas for window children
+ *
+ * Whole Evas stack is walked, so it is done on first request and then only
+ * after sub-object signals of the window report changes, when children are
+ * refreshed by EailWidget.
  *
  * @param widget an EailWidget
  * @return widget list
  */
 static Eina_List *
-eail_window_get_widget_children(EailWidget *widget)
+_eail_window_scan_children(EailWidget *widget)
 {
    Evas_Object *o, *obj = eail_widget_get_widget(widget);
    Eina_List *win_childs = NULL;
@@ -170,6 +195,189 @@ eail_window_get_widget_children(EailWidget *widget)
    return widgets;
 }
 
+/**
+ * @brief Starts tracking given sub-widget of window
+ *
+ * @param window an EailWindow
+ * @param sub_widget an Evas_Object
+ */
+static void
+_eail_window_sub_widget_track(EailWindow *window, Evas_Object *sub_widget)
+{
+   evas_object_event_callback_add(sub_widget, EVAS_CALLBACK_DEL,
+                                  eail_window_on_sub_widget_del, window);
+   evas_object_event_callback_add(sub_widget,
+                                  EVAS_CALLBACK_CHANGED_SIZE_HINTS,
+                                  eail_window_on_sub_widget_hints, window);
+}
+
+/**
+ * @brief Stops tracking given sub-widget of window and removes it from list
+ *
+ * @param window an EailWindow
+ * @param sub_widget an Evas_Object
+ */
+static void
+_eail_window_sub_widget_untrack(EailWindow *window, Evas_Object *sub_widget)
+{
+   evas_object_event_callback_del_full(sub_widget, EVAS_CALLBACK_DEL,
+                                       eail_window_on_sub_widget_del, window);
+   evas_object_event_callback_del_full(sub_widget,
+                                       EVAS_CALLBACK_CHANGED_SIZE_HINTS,
+                                       eail_window_on_sub_widget_hints,
+                                       window);
+
+   window->sub_widgets = eina_list_remove(window->sub_widgets, sub_widget);
+   window->resizable_valid = EINA_FALSE;
+}
+
+/**
+ * @brief Gets maintained list of window sub-widgets, scanning canvas if it
+ * was not fetched yet
+ *
+ * @param window an EailWindow
+ * @return list of sub-widgets owned by window
+ */
+static Eina_List *
+_eail_window_sub_widgets_get(EailWindow *window)
+{
+   Eina_List *l;
+   Evas_Object *sub_widget;
+
+   if (window->sub_widgets_valid) return window->sub_widgets;
+
+   window->sub_widgets = _eail_window_scan_children(EAIL_WIDGET(window));
+   window->sub_widgets_valid = EINA_TRUE;
+   window->resizable_valid = EINA_FALSE;
+
+   EINA_LIST_FOREACH(window->sub_widgets, l, sub_widget)
+     _eail_window_sub_widget_track(window, sub_widget);
+
+   return window->sub_widgets;
+}
+
+/**
+ * @brief Callback for deletion of window sub-widget
+ *
+ * @param data an EailWindow
+ * @param e an Evas
+ * @param obj deleted sub-widget
+ * @param event_info additional event info (not used here)
+ */
+static void
+eail_window_on_sub_widget_del(void *data, Evas *e,
+                              Evas_Object *obj, void *event_info)
+{
+   _eail_window_sub_widget_untrack(EAIL_WINDOW(data), obj);
+}
+
+/**
+ * @brief Callback for size hints change of window sub-widget
+ *
+ * @param data an EailWindow
+ * @param e an Evas
+ * @param obj changed sub-widget
+ * @param event_info additional event info (not used here)
+ */
+static void
+eail_window_on_sub_widget_hints(void *data, Evas *e,
+                                Evas_Object *obj, void *event_info)
+{
+   EAIL_WINDOW(data)->resizable_valid = EINA_FALSE;
+}
+
+/**
+ * @brief Drops list of window sub-widgets, it will be scanned again when
+ * children of window are refreshed
+ *
+ * @param window an EailWindow
+ */
+static void
+_eail_window_sub_widgets_invalidate(EailWindow *window)
+{
+   while (window->sub_widgets)
+     _eail_window_sub_widget_untrack(window, window->sub_widgets->data);
+   window->sub_widgets_valid = EINA_FALSE;
+}
+
+/**
+ * @brief Callback for sub-object added to window
+ *
+ * @param data an EailWindow
+ * @param obj window
+ * @param event_info added sub-object
+ */
+static void
+eail_window_on_sub_object_add(void *data, Evas_Object *obj, void *event_info)
+{
+   Evas_Object *sub_object = event_info;
+
+   if (!sub_object || !elm_object_widget_check(sub_object)) return;
+
+   _eail_window_sub_widgets_invalidate(EAIL_WINDOW(data));
+}
+
+/**
+ * @brief Callback for sub-object removed from window
+ *
+ * @param data an EailWindow
+ * @param obj window
+ * @param event_info removed sub-object
+ */
+static void
+eail_window_on_sub_object_del(void *data, Evas_Object *obj, void *event_info)
+{
+   if (!event_info) return;
+
+   _eail_window_sub_widgets_invalidate(EAIL_WINDOW(data));
+}
+
+/**
+ * @brief Gets widget children
+ *
+ * @param widget an EailWidget
+ * @return widget list
+ */
+static Eina_List *
+eail_window_get_widget_children(EailWidget *widget)
+{
+   return eina_list_clone(_eail_window_sub_widgets_get(EAIL_WINDOW(widget)));
+}
+
+/**
+ * @brief Checks if window content follows window size
+ *
+ * Window is resizable when all its sub-widgets expand in both directions.
+ * Result is cached until size hints or sub-widgets change.
+ *
+ * @param window an EailWindow
+ * @return EINA_TRUE if window is resizable, EINA_FALSE otherwise
+ */
+static Eina_Bool
+_eail_window_resizable_get(EailWindow *window)
+{
+   double x, y;
+   Eina_List *l, *children;
+   Evas_Object *child;
+
+   children = _eail_window_sub_widgets_get(window);
+   if (window->resizable_valid) return window->resizable;
+
+   window->resizable = EINA_TRUE;
+   EINA_LIST_FOREACH(children, l, child)
+     {
+        evas_object_size_hint_weight_get(child, &x, &y);
+        if (x != EVAS_HINT_EXPAND || y != EVAS_HINT_EXPAND)
+          {
+             window->resizable = EINA_FALSE;
+             break;
+          }
+     }
+   window->resizable_valid = EINA_TRUE;
+
+   return window->resizable;
+}
+
 /**
  * @brief Gets obj state set
  *
@@ -179,11 +387,8 @@ eail_window_get_widget_children(EailWidget *widget)
 static AtkStateSet *
 eail_window_ref_state_set(AtkObject *obj)
 {
-   double x, y;
    AtkStateSet *state_set;
-   Eina_List *l, *children;
-   Eina_Bool resizable = EINA_TRUE;
-   Evas_Object *child, *widget = eail_widget_get_widget(EAIL_WIDGET(obj));
+   Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(obj));
 
    if (!widget) return NULL;
 
@@ -204,19 +409,7 @@ eail_window_ref_state_set(AtkObject *obj)
         atk_state_set_add_state(state_set, ATK_STATE_MODAL);
      }
 
-   children = eail_widget_get_widget_children(EAIL_WIDGET(obj));
-   EINA_LIST_FOREACH(children, l, child)
-     {
-        evas_object_size_hint_weight_get(child, &x, &y);
-        if (x != EVAS_HINT_EXPAND || y != EVAS_HINT_EXPAND)
-          {
-             resizable = EINA_FALSE;
-             break;
-          }
-     }
-   eina_list_free(children);
-
-   if (resizable)
+   if (_eail_window_resizable_get(EAIL_WINDOW(obj)))
      {
         atk_state_set_add_state(state_set, ATK_STATE_RESIZABLE);
      }
@@ -232,6 +425,28 @@ eail_window_ref_state_set(AtkObject *obj)
 static void
 eail_window_init(EailWindow *window)
 {
+   window->sub_widgets = NULL;
+   window->sub_widgets_valid = EINA_FALSE;
+   window->resizable_valid = EINA_FALSE;
+}
+
+/**
+ * @brief EailWindow finalizer
+ *
+ * Callbacks are removed from sub-widgets which may outlive the window
+ * accessible.
+ *
+ * @param obj a GObject
+ */
+static void
+eail_window_finalize(GObject *obj)
+{
+   EailWindow *window = EAIL_WINDOW(obj);
+
+   while (window->sub_widgets)
+     _eail_window_sub_widget_untrack(window, window->sub_widgets->data);
+
+   G_OBJECT_CLASS(eail_window_parent_class)->finalize(obj);
 }
 
 /**
@@ -245,11 +460,14 @@ eail_window_class_init(EailWindowClass *klass)
    DBG(">");
    AtkObjectClass *class = ATK_OBJECT_CLASS(klass);
    EailWidgetClass *widget_class = EAIL_WIDGET_CLASS(klass);
+   GObjectClass *g_object_class = G_OBJECT_CLASS(klass);
 
    widget_class->get_widget_children = eail_window_get_widget_children;
+   g_object_class->finalize = eail_window_finalize;
 
    class->initialize = eail_window_initialize;
    class->ref_state_set = eail_window_ref_state_set;
+   eail_window_actions_init(klass);
 }
 
 /**
@@ -293,15 +511,16 @@ eail_action_maximize(AtkAction *action, void *data)
 /**
  * @brief Adds window actions to actions table
  *
- * @param action_widget widget that implements EailActionWidget interface
+ * @param klass EailWindowClass
  */
 static void
-eail_window_actions_init(EailActionWidget *action_widget)
+eail_window_actions_init(EailWindowClass *klass)
 {
-   eail_action_widget_action_append(action_widget,
-                                    EAIL_WIN_ACTION_MAXIMIZE, NULL,
-                                    eail_action_maximize);
-   eail_action_widget_action_append(action_widget,
-                                    EAIL_WIN_ACTION_MINIMIZE, NULL,
-                                    eail_action_minimize);
+   static const EailActionDef actions[] = {
+        {EAIL_WIN_ACTION_MAXIMIZE, NULL, eail_action_maximize},
+        {EAIL_WIN_ACTION_MINIMIZE, NULL, eail_action_minimize}
+   };
+
+   eail_action_widget_class_actions_append(EAIL_ACTION_WIDGET_CLASS(klass),
+                                           actions, G_N_ELEMENTS(actions));
 }
@@ -47,6 +47,11 @@ typedef struct _EailWindowClass EailWindowClass;
 struct _EailWindow
 {
     EailActionWidget parent;
+
+    Eina_List *sub_widgets;/*!< direct sub-widgets of window */
+    Eina_Bool sub_widgets_valid;/*!< whether sub_widgets were fetched */
+    Eina_Bool resizable;/*!< cached RESIZABLE state */
+    Eina_Bool resizable_valid;/*!< whether resizable is up to date */
 };
 
 struct _EailWindowClass
@@ -51,9 +51,13 @@ _test_day_selector_object(AtkObject *obj)
    for (i = 0; i < child_count; i++)
     {
        AtkObject *child = atk_object_ref_accessible_child(obj, i);
+       AtkObject *again = atk_object_ref_accessible_child(obj, i);
        g_assert(ATK_IS_OBJECT(child));
        g_assert(eailu_is_object_with_type(child, EAIL_TYPE_FOR_CHECK));
+       /* the same day should be represented by the same object */
+       g_assert(child == again);
 
+       g_object_unref(again);
        g_object_unref(child);
      }
 
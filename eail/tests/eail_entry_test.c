@@ -21,6 +21,7 @@ _do_test(AtkObject *obj)
    AtkRole role;
    gchar *text;
    int start_offset, end_offset;
+   int x, y, width, height;
    const char *type_name = g_type_name(G_TYPE_FROM_INSTANCE(obj));
 
    g_assert_cmpstr(type_name, ==, "EailEntry");
@@ -41,6 +42,13 @@ _do_test(AtkObject *obj)
 
         g_assert(atk_text_get_character_count(ATK_TEXT(obj)) == 440);
 
+        atk_text_get_character_extents(ATK_TEXT(obj), 12, &x, &y, &width,
+                                       &height, ATK_XY_WINDOW);
+        g_assert(width > 0 && height > 0);
+        g_assert(atk_text_get_offset_at_point(ATK_TEXT(obj), x + width / 2,
+                                              y + height / 2,
+                                              ATK_XY_WINDOW) == 12);
+
         g_assert(atk_text_set_caret_offset(ATK_TEXT(obj), 13));
         g_assert(atk_text_get_caret_offset(ATK_TEXT(obj)) == 13);
 
@@ -63,6 +71,29 @@ _do_test(AtkObject *obj)
         g_assert_cmpstr(text, ==, "Trololo lololololo olololo");
         g_free(text);
 
+        text = atk_text_get_text_at_offset(ATK_TEXT(obj), 10,
+                                           ATK_TEXT_BOUNDARY_WORD_START,
+                                           &start_offset, &end_offset);
+        g_assert_cmpstr(text, ==, "lololololo ");
+        g_assert(start_offset == 8 && end_offset == 19);
+        g_free(text);
+
+        text = atk_text_get_text_before_offset(ATK_TEXT(obj), 10,
+                                               ATK_TEXT_BOUNDARY_WORD_START,
+                                               &start_offset, &end_offset);
+        g_assert_cmpstr(text, ==, "Trololo ");
+        g_free(text);
+
+        text = atk_text_get_text_after_offset(ATK_TEXT(obj), 10,
+                                              ATK_TEXT_BOUNDARY_WORD_END,
+                                              &start_offset, &end_offset);
+        g_assert_cmpstr(text, ==, " olololo");
+        g_assert(start_offset == 18 && end_offset == 26);
+        g_free(text);
+
+        start_offset = 0;
+        end_offset = -1;
+
         //start_offset = 8;
         //end_offset = 18;
         //atk_editable_text_copy_text(ATK_EDITABLE_TEXT(obj), start_offset, end_offset);
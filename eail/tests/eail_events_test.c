@@ -0,0 +1,254 @@
+#include <Elementary.h>
+#include <atk/atk.h>
+
+#include "eail_test_utils.h"
+
+#define EAIL_TYPE_FOR_BUTTON "EailButton"
+#define EAIL_TYPE_FOR_SLIDER "EailSlider"
+#define EAIL_TYPE_FOR_BOX "EailBox"
+
+/* more than default limit of bounds notifications in one flush */
+#define N_BUTTONS 40
+#define MAX_BOUNDS_PER_FLUSH 32
+
+/* used to determine if test code has been successfully called
+ * (sometimes may happen that ATK object to test in hierarchy cannot be found)*/
+static gboolean eail_test_code_called = FALSE;
+static gboolean eail_test_started = FALSE;
+
+static Evas_Object *glob_box = NULL;
+static Evas_Object *glob_slider = NULL;
+static Evas_Object *glob_buttons[N_BUTTONS];
+
+static AtkObject *atk_box = NULL;
+static AtkObject *atk_slider = NULL;
+static Eina_List *atk_buttons = NULL;
+
+static int n_bounds = 0;
+static AtkRectangle last_bounds;
+static int n_visible_data = 0;
+static int n_value = 0;
+static int n_children_added = 0;
+static int test_step = 0;
+
+static void
+_on_done(void *data, Evas_Object *obj, void *event_info)
+{
+   elm_exit();
+}
+
+static void
+_on_bounds_changed(AtkObject *obj, AtkRectangle *bounds, gpointer data)
+{
+   n_bounds++;
+   last_bounds = *bounds;
+}
+
+static void
+_on_visible_data_changed(AtkObject *obj, gpointer data)
+{
+   n_visible_data++;
+}
+
+static void
+_on_value_changed(AtkObject *obj, AtkPropertyValues *values, gpointer data)
+{
+   n_value++;
+}
+
+static void
+_on_children_added(AtkObject *obj, guint index, gpointer child, gpointer data)
+{
+   n_children_added++;
+}
+
+static void
+_collect_button(AtkObject *obj)
+{
+   atk_buttons = eina_list_append(atk_buttons, obj);
+   g_signal_connect(obj, "bounds-changed", G_CALLBACK(_on_bounds_changed),
+                    NULL);
+}
+
+static void
+_collect_slider(AtkObject *obj)
+{
+   atk_slider = obj;
+   g_signal_connect(obj, "visible-data-changed",
+                    G_CALLBACK(_on_visible_data_changed), NULL);
+   g_signal_connect(obj, "property-change::accessible-value",
+                    G_CALLBACK(_on_value_changed), NULL);
+}
+
+static void
+_collect_box(AtkObject *obj)
+{
+   atk_box = obj;
+   g_signal_connect(obj, "children-changed::add",
+                    G_CALLBACK(_on_children_added), NULL);
+}
+
+static void
+_move_buttons(int x, int y)
+{
+   int i;
+
+   for (i = 0; i < N_BUTTONS; i++)
+     evas_object_move(glob_buttons[i], x + i, y);
+}
+
+/*
+ * Steps are run from timer, so the event queue is flushed between them when
+ * main loop enters idle state.
+ */
+static Eina_Bool
+_test_step(void *data)
+{
+   Evas_Object *button;
+
+   switch (test_step++)
+     {
+      case 0:
+         n_bounds = n_visible_data = n_value = 0;
+         g_assert(1 == atk_object_get_n_accessible_children(atk_box));
+
+         /* bursts of events are merged into one notification per object */
+         evas_object_move(glob_buttons[0], 10, 10);
+         evas_object_move(glob_buttons[0], 20, 20);
+         evas_object_move(glob_buttons[0], 30, 30);
+         evas_object_smart_callback_call(glob_slider, "changed", NULL);
+         evas_object_smart_callback_call(glob_slider, "changed", NULL);
+         evas_object_smart_callback_call(glob_slider, "changed", NULL);
+         button = elm_button_add(glob_box);
+         evas_object_show(button);
+         elm_box_pack_end(glob_box, button);
+         button = elm_button_add(glob_box);
+         evas_object_show(button);
+         elm_box_pack_end(glob_box, button);
+
+         /* nothing is emitted before main loop gets idle */
+         g_assert(0 == n_bounds);
+         g_assert(0 == n_visible_data);
+         g_assert(0 == n_value);
+         g_assert(0 == n_children_added);
+         break;
+
+      case 1:
+         g_assert(1 == n_bounds);
+         g_assert(30 == last_bounds.x && 30 == last_bounds.y);
+         g_assert(1 == n_visible_data);
+         g_assert(1 == n_value);
+         g_assert(2 == n_children_added);
+         g_assert(3 == atk_object_get_n_accessible_children(atk_box));
+
+         /* value notifications are limited to one per interval */
+         evas_object_smart_callback_call(glob_slider, "changed", NULL);
+         break;
+
+      case 2:
+         g_assert(2 == n_visible_data);
+         g_assert(1 == n_value);
+
+         /* bounds notifications are limited per flush */
+         n_bounds = 0;
+         _move_buttons(100, 100);
+         break;
+
+      case 3:
+         g_assert(MAX_BOUNDS_PER_FLUSH == n_bounds);
+         break;
+
+      case 4:
+         g_assert(N_BUTTONS == n_bounds);
+         break;
+
+      case 5:
+         /* value notification delayed by interval has been emitted */
+         g_assert(2 == n_value);
+
+         eail_test_code_called = TRUE;
+         _on_done(NULL, NULL, NULL);
+         return ECORE_CALLBACK_CANCEL;
+     }
+
+   return ECORE_CALLBACK_RENEW;
+}
+
+static void
+_on_focus_in(void *data, Evas_Object *obj, void *event_info)
+{
+   AtkObject *aobj = atk_get_root();
+   g_assert(aobj);
+
+   if (eail_test_started) return;
+   eail_test_started = TRUE;
+
+   eailu_traverse_children_for_type_call_cb(aobj, EAIL_TYPE_FOR_BUTTON,
+                                            _collect_button);
+   eailu_traverse_children_for_type_call_cb(aobj, EAIL_TYPE_FOR_SLIDER,
+                                            _collect_slider);
+   eailu_traverse_children_for_type_call_cb(aobj, EAIL_TYPE_FOR_BOX,
+                                            _collect_box);
+
+   /* one of buttons is packed in box */
+   g_assert(N_BUTTONS + 1 == eina_list_count(atk_buttons));
+   g_assert(atk_slider);
+   g_assert(atk_box);
+
+   /* value interval (0.1 s) passes between steps 1 and 5 only */
+   ecore_timer_add(0.03, _test_step, NULL);
+}
+
+static void
+_initialize_widgets(Evas_Object *win)
+{
+   Evas_Object *bg, *button;
+   int i;
+
+   bg = elm_bg_add(win);
+   evas_object_size_hint_weight_set(bg, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   elm_win_resize_object_add(win, bg);
+   evas_object_show(bg);
+
+   for (i = 0; i < N_BUTTONS; i++)
+     {
+        glob_buttons[i] = elm_button_add(win);
+        evas_object_resize(glob_buttons[i], 20, 20);
+        evas_object_move(glob_buttons[i], i, 0);
+        evas_object_show(glob_buttons[i]);
+     }
+
+   glob_slider = elm_slider_add(win);
+   evas_object_resize(glob_slider, 100, 20);
+   evas_object_move(glob_slider, 0, 40);
+   evas_object_show(glob_slider);
+
+   glob_box = elm_box_add(win);
+   evas_object_resize(glob_box, 100, 100);
+   evas_object_move(glob_box, 0, 80);
+   evas_object_show(glob_box);
+
+   button = elm_button_add(glob_box);
+   evas_object_show(button);
+   elm_box_pack_end(glob_box, button);
+}
+
+EAPI_MAIN int
+elm_main(int argc, char **argv)
+{
+   Evas_Object *win;
+
+   win = eailu_create_test_window_with_glib_init(_on_done, _on_focus_in);
+   _initialize_widgets(win);
+
+   evas_object_show(win);
+
+   elm_run();
+   elm_shutdown();
+
+   g_assert(eail_test_code_called);
+
+   /* exit code */
+   return 0;
+}
+ELM_MAIN()
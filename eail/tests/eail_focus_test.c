@@ -4,10 +4,21 @@
 #include "eail_test_utils.h"
 
 #define EAIL_TEST_BUTTON1_NAME "Button text"
+#define EAIL_TEST_BUTTON2_NAME "Second button"
+#define EAIL_TEST_BUTTON3_NAME "Third button"
 
 /* used to determine if test code has been successfully called
  * (sometimes may happen that ATK object to test in hierarchy cannot be found)*/
 static gboolean eail_test_code_called = FALSE;
+static gboolean eail_test_started = FALSE;
+
+static Evas_Object *glob_button2 = NULL;
+static Evas_Object *glob_button3 = NULL;
+static AtkObject *atk_button1 = NULL;
+static AtkObject *atk_button3 = NULL;
+
+static int n_focus_reports = 0;
+static AtkObject *last_focus_report = NULL;
 
 static void
 _on_done(void *data, Evas_Object *obj, void *event_info)
@@ -46,22 +57,63 @@ _test_focus_on_button(AtkObject *obj)
    g_assert(focused_obj == obj);
 
    printf("DONE. All focus test passed successfully \n");
+}
+
+static void
+_on_focus_tracked(AtkObject *obj)
+{
+   n_focus_reports++;
+   last_focus_report = obj;
+}
+
+static Eina_Bool
+_test_focus_reported(void *data)
+{
+   /* only the last focused object is reported */
+   g_assert(1 == n_focus_reports);
+   g_assert(atk_button3 == last_focus_report);
+
+   /* focus grabbed through ATK is reported immediately */
+   g_assert(atk_component_grab_focus(ATK_COMPONENT(atk_button1)));
+   g_assert(2 == n_focus_reports);
+   g_assert(atk_button1 == last_focus_report);
+
    eail_test_code_called = TRUE;
+   elm_exit();
+
+   return ECORE_CALLBACK_CANCEL;
+}
+
+static void
+_test_focus_collapsed(void)
+{
+   atk_add_focus_tracker(_on_focus_tracked);
+
+   /* focus jumps through several widgets in one main loop iteration */
+   elm_object_focus_set(glob_button2, EINA_TRUE);
+   elm_object_focus_set(glob_button3, EINA_TRUE);
+   g_assert(0 == n_focus_reports);
+
+   /* focus is reported when main loop gets idle */
+   ecore_timer_add(0.01, _test_focus_reported, NULL);
 }
 
 static void
 _on_focus_in(void *data, Evas_Object *obj, void *event_info)
 {
-   AtkObject *button;
    AtkObject *aobj = atk_get_root();
    g_assert(aobj);
 
+   if (eail_test_started) return;
+   eail_test_started = TRUE;
+
    /* button 1 */
-   button = eailu_find_child_with_name(aobj, EAIL_TEST_BUTTON1_NAME);
-   _test_focus_on_button(button);
+   atk_button1 = eailu_find_child_with_name(aobj, EAIL_TEST_BUTTON1_NAME);
+   atk_button3 = eailu_find_child_with_name(aobj, EAIL_TEST_BUTTON3_NAME);
+   g_assert(atk_button3);
+   _test_focus_on_button(atk_button1);
 
-   g_assert(eail_test_code_called);
-   elm_exit();
+   _test_focus_collapsed();
 }
 
 static void
@@ -80,6 +132,18 @@ _initialize_and_show_buttons(Evas_Object *win)
    evas_object_resize(button1, 100, 60);
    evas_object_move(button1, 50, 20);
    evas_object_show(button1);
+
+   glob_button2 = elm_button_add(win);
+   elm_object_text_set(glob_button2, EAIL_TEST_BUTTON2_NAME);
+   evas_object_resize(glob_button2, 100, 60);
+   evas_object_move(glob_button2, 50, 100);
+   evas_object_show(glob_button2);
+
+   glob_button3 = elm_button_add(win);
+   elm_object_text_set(glob_button3, EAIL_TEST_BUTTON3_NAME);
+   evas_object_resize(glob_button3, 100, 60);
+   evas_object_move(glob_button3, 50, 180);
+   evas_object_show(glob_button3);
 }
 
 EAPI_MAIN int
@@ -95,6 +159,8 @@ elm_main(int argc, char **argv)
    elm_run();
    elm_shutdown();
 
+   g_assert(eail_test_code_called);
+
    /* exit code */
    return 0;
 }
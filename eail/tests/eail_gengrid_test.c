@@ -8,6 +8,7 @@ typedef struct _Example_Item
 } Example_Item;
 
 static Elm_Gengrid_Item_Class *gic = NULL;
+static Evas_Object *glob_grid = NULL;
 
 static const char *imgs[9] =
 {
@@ -92,14 +93,49 @@ _print_object_info(AtkObject *obj)
    printf("atk_object_get_type_name: %s\n", type_name ? type_name : "NULL");
 }
 
+static void
+_test_item_replacement(AtkObject *obj)
+{
+   Elm_Object_Item *item, *next, *inserted;
+   AtkObject *child;
+   int i;
+
+   item = elm_gengrid_first_item_get(glob_grid);
+   for (i = 0; i < 4; i++)
+     item = elm_gengrid_item_next_get(item);
+
+   /* item count stays unchanged */
+   next = elm_gengrid_item_next_get(item);
+   elm_object_item_del(item);
+   inserted = elm_gengrid_item_insert_before(glob_grid, gic, _item_new(4),
+                                             next, NULL, NULL);
+   g_assert(atk_object_get_n_accessible_children(obj) == 9);
+
+   atk_selection_clear_selection(ATK_SELECTION(obj));
+   g_assert(atk_selection_add_selection(ATK_SELECTION(obj), 4));
+   g_assert(elm_gengrid_item_selected_get(inserted));
+
+   child = atk_object_ref_accessible_child(obj, 5);
+   g_assert(child);
+   g_assert(atk_object_get_index_in_parent(child) == 5);
+   g_object_unref(child);
+
+   elm_object_item_del(elm_gengrid_last_item_get(glob_grid));
+   g_assert(atk_object_get_n_accessible_children(obj) == 8);
+   g_assert(atk_table_get_index_at(ATK_TABLE(obj), 2, 1) == 7);
+}
+
 static void
 _test_gengrid_object(AtkObject *obj)
 {
    int child_count = atk_object_get_n_accessible_children(obj);
-   int rows, cols, row_at_index, column_at_index, index_at;
+   int rows, cols, row_at_index, column_at_index, index_at, n_selected;
+   gint *selected = NULL;
    gboolean success;
    AtkTable *table;
    AtkObject *table_child;
+   /* all items are exposed, not only realized ones */
+   g_assert(child_count == 9);
    for (int i = 0; i < child_count; i++)
      {
         AtkObject *child = atk_object_ref_accessible_child(obj, i);
@@ -115,16 +151,23 @@ _test_gengrid_object(AtkObject *obj)
    row_at_index = atk_table_get_row_at_index(table, 4);
    g_assert(row_at_index == 1);
    column_at_index = atk_table_get_column_at_index(table, 2);
-   g_assert(column_at_index == 0);
+   g_assert(column_at_index == 2);
    index_at = atk_table_get_index_at(table, 2, 2);
    g_assert(index_at == 8);
    table_child = atk_table_ref_at(table, 1, 1);
    g_assert(ATK_IS_OBJECT(table_child));
+   /* cells are numbered the same way as children */
+   g_assert(atk_object_get_index_in_parent(table_child) == 4);
    _print_object_info(table_child);
    success = atk_table_add_column_selection(table, 1);
    g_assert(success);
    success =  atk_table_is_column_selected(table, 1);
    g_assert(success);
+   n_selected = atk_table_get_selected_columns(table, &selected);
+   g_assert(n_selected == 1 && selected[0] == 1);
+   g_free(selected);
+   g_assert(atk_table_get_selected_rows(table, &selected) == 0);
+   g_free(selected);
    success = atk_table_remove_column_selection(table, 1);
    g_assert(success);
    success = atk_table_add_row_selection(table, 1);
@@ -134,6 +177,7 @@ _test_gengrid_object(AtkObject *obj)
    success = atk_table_remove_row_selection(table, 0);
    g_assert(success);
 
+   _test_item_replacement(obj);
 }
 static Ecore_Timer *timer_delay;
 
@@ -183,7 +227,7 @@ elm_main(int argc, char **argv)
    evas_object_size_hint_weight_set(bg, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
    elm_win_resize_object_add(win, bg);
    evas_object_show(bg);
-   grid = elm_gengrid_add(win);
+   glob_grid = grid = elm_gengrid_add(win);
 
    elm_gengrid_item_size_set(grid, 200, 200);
    evas_object_size_hint_weight_set(grid, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
@@ -27,20 +27,27 @@ on_done(void *data, Evas_Object *obj, void *event_info)
 void
 _test_list_item_interfaces(AtkObject *item_object)
 {
+   gint x, y, width, height;
+
    g_assert(ATK_IS_OBJECT(item_object));
    g_assert(eailu_is_object_with_type(item_object, EAIL_TYPE_FOR_LIST_ITEM));
 
-   /**
-    * for single list items focusing does NOT work
-    */
-   eailu_test_atk_focus(item_object, FALSE);
+   /* grabbing focus of item focuses genlist on that item */
+   eailu_test_atk_focus(item_object, TRUE);
 
    g_assert(ATK_IS_ACTION(item_object));
+
+   /* off-screen items are placed next to realized ones */
+   atk_component_get_extents(ATK_COMPONENT(item_object), &x, &y, &width,
+                             &height, ATK_XY_WINDOW);
+   g_assert(width > 0 && height > 0);
 }
 
 void
 _test_item_selection_single(AtkObject *parent, AtkObject *child, int index)
 {
+   AtkObject *selected;
+
    g_assert(ATK_IS_SELECTION(parent));
    /* in single selection mode it should return FALSE */
    g_assert(!atk_selection_select_all_selection(ATK_SELECTION(parent)));
@@ -51,6 +58,12 @@ _test_item_selection_single(AtkObject *parent, AtkObject *child, int index)
    g_assert(atk_selection_is_child_selected(ATK_SELECTION(parent), index));
    g_assert(1 == atk_selection_get_selection_count(ATK_SELECTION(parent)));
 
+   /* the only selected item is returned as the first selection */
+   selected = atk_selection_ref_selection(ATK_SELECTION(parent), 0);
+   g_assert(selected);
+   g_assert(index == atk_object_get_index_in_parent(selected));
+   g_object_unref(selected);
+
    /* now removing selection using atk_selection interface */
    g_assert(atk_selection_remove_selection(ATK_SELECTION(parent),index));
    g_assert
@@ -104,6 +117,53 @@ _test_scrolling_actions(AtkObject *aobj)
    g_assert(0 == g_strcmp0(result_desc, test_desc));
 }
 
+static void
+_test_item_identity(AtkObject *aobj, int index)
+{
+   AtkObject *first = atk_object_ref_accessible_child(aobj, index);
+   AtkObject *second = atk_object_ref_accessible_child(aobj, index);
+
+   /* the same item should be represented by the same accessible object */
+   g_assert(first);
+   g_assert(first == second);
+   g_assert(index == atk_object_get_index_in_parent(first));
+
+   g_object_unref(first);
+   g_object_unref(second);
+}
+
+static void
+_test_item_deletion(AtkObject *aobj)
+{
+   Elm_Object_Item *item, *prev, *inserted;
+   AtkObject *child;
+   int index = N_ITEMS - 2;
+
+   /* maps all items */
+   child = atk_object_ref_accessible_child(aobj, N_ITEMS - 1);
+   g_assert(child);
+   g_object_unref(child);
+
+   /* item without accessible is replaced, keeping item count unchanged */
+   item = elm_genlist_nth_item_get(glob_genlist, index);
+   prev = elm_genlist_item_prev_get(item);
+   inserted = elm_genlist_item_insert_after
+      (glob_genlist, elm_genlist_item_item_class_get(item),
+       (void *) (long) nitems++, elm_genlist_item_parent_get(item), prev,
+       ELM_GENLIST_ITEM_NONE, NULL, NULL);
+   elm_object_item_del(item);
+   g_assert(N_ITEMS == atk_object_get_n_accessible_children(aobj));
+
+   atk_selection_clear_selection(ATK_SELECTION(aobj));
+   g_assert(atk_selection_add_selection(ATK_SELECTION(aobj), index));
+   g_assert(elm_genlist_item_selected_get(inserted));
+
+   child = atk_object_ref_accessible_child(aobj, index);
+   g_assert(child);
+   g_assert(index == atk_object_get_index_in_parent(child));
+   g_object_unref(child);
+}
+
 void
 _test_list_atk_obj(AtkObject *aobj)
 {
@@ -127,13 +187,22 @@ _test_list_atk_obj(AtkObject *aobj)
         //g_assert(2 == atk_object_get_n_accessible_children(child));
 
         _test_list_item_interfaces(child);
+        _test_item_identity(aobj, i);
         _test_item_selection_single(aobj, child, i);
 
         g_object_unref(child);
      }
 
+   /* every item is a single cell row of table */
+   g_assert(ATK_IS_TABLE(aobj));
+   g_assert(N_ITEMS == atk_table_get_n_rows(ATK_TABLE(aobj)));
+   g_assert(1 == atk_table_get_n_columns(ATK_TABLE(aobj)));
+   g_assert(5 == atk_table_get_row_at_index(ATK_TABLE(aobj), 5));
+   g_assert(5 == atk_table_get_index_at(ATK_TABLE(aobj), 5, 0));
+
    /* now quick check if multiselection on list works properly*/
    _test_multiselection_list(aobj);
+   _test_item_deletion(aobj);
    eail_test_code_called = TRUE;
    printf("DONE. All test passed successfully \n");
 }
@@ -49,6 +49,65 @@ _change_slider_cb(void *data, Evas_Object *obj, void *event_info)
    elm_label_slide_duration_set(lb, val);
 }
 
+static void
+_test_accessible_at_point(AtkObject *obj)
+{
+   AtkObject *child, *found;
+   gint x, y, width, height, i;
+
+   for (i = 0; i < atk_object_get_n_accessible_children(obj); ++i)
+     {
+        child = atk_object_ref_accessible_child(obj, i);
+        g_assert(ATK_IS_COMPONENT(child));
+
+        atk_component_get_extents(ATK_COMPONENT(child), &x, &y, &width,
+                                  &height, ATK_XY_WINDOW);
+        if (width <= 0 || height <= 0)
+          {
+             g_object_unref(child);
+             continue;
+          }
+
+        /* grid children do not overlap, so child is found at its center */
+        g_assert(atk_component_contains(ATK_COMPONENT(obj), x + width / 2,
+                                        y + height / 2, ATK_XY_WINDOW));
+        found = atk_component_ref_accessible_at_point
+           (ATK_COMPONENT(obj), x + width / 2, y + height / 2, ATK_XY_WINDOW);
+        g_assert(found == child);
+
+        g_object_unref(found);
+        g_object_unref(child);
+     }
+
+   g_assert(!atk_component_ref_accessible_at_point(ATK_COMPONENT(obj), -10,
+                                                   -10, ATK_XY_WINDOW));
+}
+
+static void
+_test_grid_cells(AtkObject *obj)
+{
+   AtkTable *table;
+   int index;
+
+   g_assert(ATK_IS_TABLE(obj));
+   table = ATK_TABLE(obj);
+
+   /* children start at 6 distinct rows, three radios share one of them */
+   g_assert(6 == atk_table_get_n_rows(table));
+   g_assert(3 == atk_table_get_n_columns(table));
+
+   index = atk_table_get_index_at(table, 4, 1);
+   g_assert(index >= 0);
+   g_assert(1 == atk_table_get_column_at_index(table, index));
+   g_assert(1 == atk_table_get_column_extent_at(table, 4, 1));
+
+   /* labels span whole grid width */
+   index = atk_table_get_index_at(table, 0, 2);
+   g_assert(index >= 0);
+   g_assert(0 == atk_table_get_column_at_index(table, index));
+   g_assert(3 == atk_table_get_column_extent_at(table, 0, 2));
+}
+
 static void
 _do_test(AtkObject *obj)
 {
@@ -62,6 +121,9 @@ _do_test(AtkObject *obj)
 
    // test children
    g_assert(8 == atk_object_get_n_accessible_children(obj));
+
+   _test_accessible_at_point(obj);
+   _test_grid_cells(obj);
 }
 
 static void
@@ -76,6 +76,15 @@ _do_test(AtkObject *obj)
 
    /* atk_text_get_character_count */
    g_assert(atk_text_get_character_count(ATK_TEXT(obj)) == 440);
+
+   /* atk_text_get_run_attributes */
+   AtkAttributeSet *attributes;
+   gint start_offset, end_offset;
+
+   attributes = atk_text_get_run_attributes(ATK_TEXT(obj), 12, &start_offset,
+                                            &end_offset);
+   g_assert(start_offset <= 12 && end_offset > 12);
+   atk_attribute_set_free(attributes);
 }
 
 static void
@@ -36,6 +36,8 @@ _test_list_item_interfaces(AtkObject *item_object)
 void
 _test_item_selection_single(AtkObject *parent, AtkObject *child, int index)
 {
+   AtkObject *selected;
+
    g_assert(ATK_IS_SELECTION(parent));
    /* in single selection mode it should return FALSE */
    g_assert(!atk_selection_select_all_selection(ATK_SELECTION(parent)));
@@ -47,6 +49,14 @@ _test_item_selection_single(AtkObject *parent, AtkObject *child, int index)
   g_assert(atk_selection_is_child_selected(ATK_SELECTION(parent), index));
   g_assert(1 == atk_selection_get_selection_count(ATK_SELECTION(parent)));
 
+  /* the only selected item is returned as the first selection */
+  selected = atk_selection_ref_selection(ATK_SELECTION(parent), 0);
+  g_assert(selected);
+  g_assert(index == atk_object_get_index_in_parent(selected));
+  /* the same item should be represented by the same accessible object */
+  g_assert(selected == child);
+  g_object_unref(selected);
+
   /* now removing selection using atk_selection interface */
   g_assert(atk_selection_remove_selection(ATK_SELECTION(parent),index));
   g_assert
@@ -99,6 +109,77 @@ _test_scrolling_actions(AtkObject *aobj)
    g_assert(0 == g_strcmp0(result_desc, test_desc));
 }
 
+static void
+_on_extra_item_del(void *data, Evas_Object *obj, void *event_info)
+{
+   *(gboolean *)data = TRUE;
+}
+
+static void
+_test_item_deletion(AtkObject *aobj)
+{
+   Elm_Object_Item *item;
+   AtkObject *child;
+   AtkStateSet *state_set;
+   gboolean deleted = FALSE;
+
+   item = elm_list_item_append(glob_elm_list, "Extra", NULL, NULL, NULL, NULL);
+   elm_list_go(glob_elm_list);
+   g_assert(8 == atk_object_get_n_accessible_children(aobj));
+
+   child = atk_object_ref_accessible_child(aobj, 7);
+   g_assert(child);
+
+   /* application may set its deletion callback after accessible is created */
+   elm_object_item_data_set(item, &deleted);
+   elm_object_item_del_cb_set(item, _on_extra_item_del);
+   elm_object_item_del(item);
+   g_assert(deleted);
+
+   /* accessible outliving its item must not point to deleted item */
+   state_set = atk_object_ref_state_set(child);
+   g_assert(atk_state_set_contains_state(state_set, ATK_STATE_DEFUNCT));
+   g_object_unref(state_set);
+   g_object_unref(child);
+
+   g_assert(7 == atk_object_get_n_accessible_children(aobj));
+}
+
+static void
+_test_item_replacement(AtkObject *aobj)
+{
+   Elm_Object_Item *middle, *last, *inserted;
+   AtkObject *child;
+
+   middle = elm_list_item_append(glob_elm_list, "Middle", NULL, NULL, NULL,
+                                 NULL);
+   last = elm_list_item_append(glob_elm_list, "Last", NULL, NULL, NULL, NULL);
+   elm_list_go(glob_elm_list);
+
+   /* maps all items, appended ones have no accessible yet */
+   child = atk_object_ref_accessible_child(aobj, 0);
+   g_assert(child);
+   g_object_unref(child);
+   g_assert(9 == atk_object_get_n_accessible_children(aobj));
+
+   /* keeps the first and last item and item count unchanged */
+   elm_object_item_del(middle);
+   inserted = elm_list_item_insert_before(glob_elm_list, last, "Inserted",
+                                          NULL, NULL, NULL, NULL);
+   elm_list_go(glob_elm_list);
+   g_assert(9 == atk_object_get_n_accessible_children(aobj));
+
+   child = atk_object_ref_accessible_child(aobj, 7);
+   g_assert(child);
+   g_assert(!g_strcmp0("Inserted", atk_object_get_name(child)));
+   g_assert(7 == atk_object_get_index_in_parent(child));
+   g_object_unref(child);
+
+   elm_object_item_del(inserted);
+   elm_object_item_del(last);
+   g_assert(7 == atk_object_get_n_accessible_children(aobj));
+}
+
 void
 _test_list_atk_obj(AtkObject *aobj)
 {
@@ -131,6 +212,8 @@ _test_list_atk_obj(AtkObject *aobj)
 
    /* now quick check if multiselection on list works properly*/
    _test_multiselection_list(aobj);
+   _test_item_deletion(aobj);
+   _test_item_replacement(aobj);
    eail_test_code_called = TRUE;
    printf("DONE. All test passed successfully \n");
 }
@@ -49,6 +49,9 @@ _do_test_photocam(AtkObject *obj)
    g_assert(ACTIONS_NUMBER == atk_action_get_n_actions(ATK_ACTION(obj)));
    eailu_test_action_activate(ATK_ACTION(obj), "click");
    g_assert((eailu_get_action_number(ATK_ACTION(obj), "typo")) == -1);
+   /* scroll actions inherited from scrollable widget go first */
+   g_assert((eailu_get_action_number(ATK_ACTION(obj), "scroll_up")) == 0);
+   g_assert((eailu_get_action_number(ATK_ACTION(obj), "click")) == 6);
    eailu_test_action_description_all(ATK_ACTION(obj));
 
    for (int count = 0; ACTIONS_NUMBER > count; count++)
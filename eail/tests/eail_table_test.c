@@ -5,6 +5,8 @@
 
 #include "eail_test_utils.h"
 
+static Evas_Object *glob_table = NULL;
+
 static void
 _init_table(Evas_Object *win)
 {
@@ -15,7 +17,7 @@ _init_table(Evas_Object *win)
    elm_win_resize_object_add(win, bg);
    evas_object_show(bg);
 
-   table = elm_table_add(win);
+   glob_table = table = elm_table_add(win);
    elm_win_resize_object_add(win, table);
    evas_object_show(table);
    elm_table_padding_set(table, 5, 5);
@@ -42,6 +44,77 @@ _init_table(Evas_Object *win)
    elm_table_pack(table, label, 1, 1, 1, 1);
 }
 
+static const char *
+_get_attribute(AtkAttributeSet *attributes, const char *name)
+{
+   for (; attributes; attributes = attributes->next)
+     {
+        AtkAttribute *attr = attributes->data;
+        if (!strcmp(attr->name, name)) return attr->value;
+     }
+
+   return NULL;
+}
+
+static void
+_test_table_cells(AtkObject *obj)
+{
+   AtkTable *table;
+   AtkObject *cell;
+   AtkAttributeSet *attributes;
+   int index;
+
+   g_assert(ATK_IS_TABLE(obj));
+   table = ATK_TABLE(obj);
+
+   g_assert(2 == atk_table_get_n_rows(table));
+   g_assert(2 == atk_table_get_n_columns(table));
+
+   /* "label 2" is packed at column 0, row 1 */
+   index = atk_table_get_index_at(table, 1, 0);
+   g_assert(index >= 0);
+   g_assert(1 == atk_table_get_row_at_index(table, index));
+   g_assert(0 == atk_table_get_column_at_index(table, index));
+   g_assert(1 == atk_table_get_row_extent_at(table, 1, 0));
+   g_assert(1 == atk_table_get_column_extent_at(table, 1, 0));
+   g_assert(-1 == atk_table_get_index_at(table, 2, 0));
+
+   cell = atk_table_ref_at(table, 1, 0);
+   g_assert(cell);
+   g_assert(index == atk_object_get_index_in_parent(cell));
+
+   attributes = atk_object_get_attributes(cell);
+   g_assert_cmpstr(_get_attribute(attributes, "table-cell-row"), ==, "1");
+   g_assert_cmpstr(_get_attribute(attributes, "table-cell-column"), ==, "0");
+   atk_attribute_set_free(attributes);
+   g_object_unref(cell);
+}
+
+static void
+_test_table_pack(AtkObject *obj)
+{
+   Evas_Object *label;
+   AtkObject *child;
+
+   label = elm_label_add(glob_table);
+   elm_object_text_set(label, "label 4");
+   evas_object_show(label);
+
+   /* children are refreshed on request, before idle refresh runs */
+   elm_table_pack(glob_table, label, 0, 2, 1, 1);
+   g_assert(5 == atk_object_get_n_accessible_children(obj));
+
+   child = atk_object_ref_accessible_child(obj, 4);
+   g_assert(child);
+   g_assert(4 == atk_object_get_index_in_parent(child));
+   g_object_unref(child);
+
+   elm_table_unpack(glob_table, label);
+   g_assert(4 == atk_object_get_n_accessible_children(obj));
+
+   evas_object_del(label);
+}
+
 static void
 _do_test(AtkObject *obj)
 {
@@ -66,6 +139,9 @@ _do_test(AtkObject *obj)
        _printf(" child num: %d, type_name: %s\n", count, type_name_child);
        g_assert(!strcmp(type_name_child, "EailLabel"));
      }
+
+   _test_table_cells(obj);
+   _test_table_pack(obj);
 }
 
 static void
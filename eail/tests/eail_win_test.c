@@ -1,15 +1,44 @@
+#include <string.h>
+
 #include <Elementary.h>
 #include <atk/atk.h>
+#include <gmodule.h>
 
+#include "eail.h"
 #include "eail_test_utils.h"
 
 #define EAIL_TYPE_FOR_WINDOW "EailWindow"
 #define EAIL_ACTION_FOR_MAXIMIZE "maximize"
 #define EAIL_ACTION_FOR_MINIMIZE "minimize"
 
+/* serialized snapshot layout, see eail_tree_snapshot_serialize */
+#define SNAPSHOT_HEADER_SIZE 16
+#define SNAPSHOT_NODE_SIZE 44
+#define SNAPSHOT_NODE_PARENT 32
+#define SNAPSHOT_NODE_FIRST_CHILD 36
+#define SNAPSHOT_NODE_N_CHILDREN 40
+
+typedef Eail_Tree_Snapshot *(*Snapshot_Func)(Evas_Object *win);
+typedef void (*Snapshot_Free_Func)(Eail_Tree_Snapshot *snapshot);
+typedef const char *(*Snapshot_Name_Get_Func)
+                                 (const Eail_Tree_Snapshot *snapshot,
+                                  unsigned int index);
+typedef unsigned char *(*Snapshot_Serialize_Func)
+                                 (const Eail_Tree_Snapshot *snapshot,
+                                  unsigned int *size);
+
 /* used to determine if test code has been successfully called
  * (sometimes may happen that ATK object to test in hierarchy cannot be found)*/
 static gboolean eail_test_code_called = FALSE;
+static gboolean eail_test_started = FALSE;
+
+static Evas_Object *glob_win = NULL;
+static Evas_Object *glob_label = NULL;
+static AtkObject *atk_win = NULL;
+static gint n_win_children = 0;
+static int n_children_added = 0;
+static int n_children_removed = 0;
+static int test_step = 0;
 
 static void
 _on_done(void *data, Evas_Object *obj, void *event_info)
@@ -17,11 +46,36 @@ _on_done(void *data, Evas_Object *obj, void *event_info)
    elm_exit();
 }
 
+static void
+_test_window_identity(AtkObject *obj)
+{
+   AtkObject *parent = atk_object_get_parent(obj);
+   gint index = atk_object_get_index_in_parent(obj);
+   AtkObject *first = NULL, *second = NULL;
+
+   g_assert(parent);
+   g_assert(index >= 0);
+
+   /* the same widget should be always represented by the same object */
+   first = atk_object_ref_accessible_child(parent, index);
+   second = atk_object_ref_accessible_child(parent, index);
+   g_assert(first == obj);
+   g_assert(first == second);
+
+   g_object_unref(first);
+   g_object_unref(second);
+}
+
 static void
 _test_window(AtkObject *obj)
 {
    _printf("Testing win instance....\n");
 
+   if (!g_strcmp0(atk_object_get_name(obj), elm_win_title_get(glob_win)))
+     atk_win = obj;
+
+   _test_window_identity(obj);
+
    g_assert(ATK_IS_ACTION(obj));
    g_assert(2 == atk_action_get_n_actions(ATK_ACTION(obj)));
 
@@ -32,17 +86,259 @@ _test_window(AtkObject *obj)
    _printf("DONE. All WIN test passed successfully \n");
 }
 
+static unsigned int
+_get_u32(const unsigned char *buf)
+{
+   return buf[0] | (buf[1] << 8) | (buf[2] << 16) |
+          ((unsigned int)buf[3] << 24);
+}
+
+/* EAIL is loaded as elementary module, so its API is looked up at runtime */
+static gpointer
+_eail_symbol_get(const gchar *name)
+{
+   GModule *self = g_module_open(NULL, 0);
+   gpointer symbol = NULL;
+   gboolean found;
+
+   g_assert(self);
+   found = g_module_symbol(self, name, &symbol);
+   g_assert(found && symbol);
+   g_module_close(self);
+
+   return symbol;
+}
+
+static void
+_test_tree_snapshot(Evas_Object *win)
+{
+   Snapshot_Func snapshot_get = _eail_symbol_get("eail_tree_snapshot");
+   Snapshot_Free_Func snapshot_free =
+      _eail_symbol_get("eail_tree_snapshot_free");
+   Snapshot_Name_Get_Func name_get =
+      _eail_symbol_get("eail_tree_snapshot_name_get");
+   Snapshot_Serialize_Func serialize =
+      _eail_symbol_get("eail_tree_snapshot_serialize");
+   Eail_Tree_Snapshot *snapshot;
+   GPtrArray *objects;
+   GHashTable *visited;
+   AtkObject *obj, *child;
+   unsigned char *buf, *node;
+   unsigned int i, size, n_found = 1;
+   gint j, n;
+
+   _printf("Testing tree snapshot....\n");
+
+   snapshot = snapshot_get(win);
+   g_assert(snapshot);
+   g_assert(snapshot->count > 1);
+   g_assert(EAIL_TREE_NO_PARENT == snapshot->nodes[0].parent);
+   g_assert(ATK_ROLE_WINDOW == snapshot->nodes[0].role);
+   g_assert(!strcmp(elm_win_title_get(win), name_get(snapshot, 0)));
+
+   /* walk the same tree breadth-first, nodes should follow the same order */
+   objects = g_ptr_array_new_with_free_func(g_object_unref);
+   visited = g_hash_table_new(NULL, NULL);
+   obj = atk_get_root();
+   for (j = 0, n = atk_object_get_n_accessible_children(obj); j < n; ++j)
+     {
+        child = atk_object_ref_accessible_child(obj, j);
+        if (eailu_is_object_with_type(child, EAIL_TYPE_FOR_WINDOW) &&
+            !g_strcmp0(atk_object_get_name(child), elm_win_title_get(win)))
+          {
+             g_ptr_array_add(objects, child);
+             break;
+          }
+        g_object_unref(child);
+     }
+   g_assert(1 == objects->len);
+   g_hash_table_insert(visited, objects->pdata[0], objects->pdata[0]);
+
+   for (i = 0; i < objects->len; ++i)
+     {
+        obj = objects->pdata[i];
+        g_assert(i < snapshot->count);
+        g_assert(atk_object_get_role(obj) == snapshot->nodes[i].role);
+        g_assert(snapshot->nodes[i].first_child == n_found);
+
+        n = atk_object_get_n_accessible_children(obj);
+        for (j = 0; j < n; ++j)
+          {
+             child = atk_object_ref_accessible_child(obj, j);
+             if (!child) continue;
+             if (g_hash_table_lookup(visited, child))
+               {
+                  g_object_unref(child);
+                  continue;
+               }
+
+             g_assert(n_found < snapshot->count);
+             g_assert(i == (unsigned int)snapshot->nodes[n_found].parent);
+             g_hash_table_insert(visited, child, child);
+             g_ptr_array_add(objects, child);
+             n_found++;
+          }
+
+        g_assert(snapshot->nodes[i].n_children ==
+                 n_found - snapshot->nodes[i].first_child);
+     }
+   g_assert(snapshot->count == objects->len);
+
+   /* both buttons are in the tree, below the window */
+   for (i = 1; i < snapshot->count; ++i)
+     {
+        if (!strcmp("First", name_get(snapshot, i)) ||
+            !strcmp("Second", name_get(snapshot, i)))
+          n_found--;
+     }
+   g_assert(snapshot->count - 2 == n_found);
+
+   g_hash_table_destroy(visited);
+   g_ptr_array_free(objects, TRUE);
+
+   /* header, fixed size nodes and names buffer */
+   buf = serialize(snapshot, &size);
+   g_assert(buf);
+   g_assert(SNAPSHOT_HEADER_SIZE + snapshot->count * SNAPSHOT_NODE_SIZE +
+            snapshot->names_size == size);
+   g_assert(!memcmp(buf, "EAIL", 4));
+   g_assert(1 == _get_u32(buf + 4));
+   g_assert(snapshot->count == _get_u32(buf + 8));
+   g_assert(snapshot->names_size == _get_u32(buf + 12));
+
+   for (i = 0; i < snapshot->count; ++i)
+     {
+        node = buf + SNAPSHOT_HEADER_SIZE + i * SNAPSHOT_NODE_SIZE;
+        g_assert((unsigned int)snapshot->nodes[i].role == _get_u32(node));
+        g_assert((unsigned int)snapshot->nodes[i].parent ==
+                 _get_u32(node + SNAPSHOT_NODE_PARENT));
+        g_assert(snapshot->nodes[i].first_child ==
+                 _get_u32(node + SNAPSHOT_NODE_FIRST_CHILD));
+        g_assert(snapshot->nodes[i].n_children ==
+                 _get_u32(node + SNAPSHOT_NODE_N_CHILDREN));
+     }
+   g_assert(!memcmp(buf + size - snapshot->names_size, snapshot->names,
+                    snapshot->names_size));
+
+   free(buf);
+   snapshot_free(snapshot);
+
+   _printf("DONE. Tree snapshot test passed successfully \n");
+}
+
+static gboolean
+_is_resizable(AtkObject *obj)
+{
+   AtkStateSet *state_set = atk_object_ref_state_set(obj);
+   gboolean resizable;
+
+   resizable = atk_state_set_contains_state(state_set, ATK_STATE_RESIZABLE);
+   g_object_unref(state_set);
+
+   return resizable;
+}
+
+static void
+_on_children_added(AtkObject *obj, guint index, gpointer child, gpointer data)
+{
+   n_children_added++;
+}
+
+static void
+_on_children_removed(AtkObject *obj, guint index, gpointer child,
+                     gpointer data)
+{
+   n_children_removed++;
+}
+
+/*
+ * Steps are run from timer, so window children are rescanned between them
+ * when main loop enters idle state.
+ */
+static Eina_Bool
+_test_sub_object_step(void *data)
+{
+   switch (test_step++)
+     {
+      case 0:
+         /* the only sub-widget of window is expanding box */
+         n_win_children = atk_object_get_n_accessible_children(atk_win);
+         g_assert(_is_resizable(atk_win));
+         g_signal_connect(atk_win, "children-changed::add",
+                          G_CALLBACK(_on_children_added), NULL);
+         g_signal_connect(atk_win, "children-changed::remove",
+                          G_CALLBACK(_on_children_removed), NULL);
+
+         glob_label = elm_label_add(glob_win);
+         elm_object_text_set(glob_label, "Third");
+         evas_object_show(glob_label);
+
+         /* window children are rescanned once main loop gets idle */
+         g_assert(0 == n_children_added);
+         break;
+
+      case 1:
+         g_assert(1 == n_children_added);
+         g_assert(n_win_children + 1 ==
+                  atk_object_get_n_accessible_children(atk_win));
+         /* label does not expand */
+         g_assert(!_is_resizable(atk_win));
+
+         evas_object_del(glob_label);
+         break;
+
+      case 2:
+         g_assert(1 == n_children_removed);
+         g_assert(n_win_children ==
+                  atk_object_get_n_accessible_children(atk_win));
+         g_assert(_is_resizable(atk_win));
+
+         elm_exit();
+         return ECORE_CALLBACK_CANCEL;
+     }
+
+   return ECORE_CALLBACK_RENEW;
+}
+
 static void
 _on_focus_in(void *data, Evas_Object *obj, void *event_info)
 {
    AtkObject *aobj = atk_get_root();
    g_assert(aobj);
 
+   if (eail_test_started) return;
+   eail_test_started = TRUE;
+
    eailu_traverse_children_for_type_call_cb
                                     (aobj, EAIL_TYPE_FOR_WINDOW, _test_window);
 
    g_assert(eail_test_code_called);
-   elm_exit();
+   g_assert(atk_win);
+
+   _test_tree_snapshot(obj);
+
+   ecore_timer_add(0.01, _test_sub_object_step, NULL);
+}
+
+static void
+_initialize_window(Evas_Object *win)
+{
+   Evas_Object *box, *button;
+
+   box = elm_box_add(win);
+   evas_object_size_hint_weight_set(box, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   elm_win_resize_object_add(win, box);
+   evas_object_show(box);
+
+   button = elm_button_add(win);
+   elm_object_text_set(button, "First");
+   elm_box_pack_end(box, button);
+   evas_object_show(button);
+
+   button = elm_button_add(win);
+   elm_object_text_set(button, "Second");
+   elm_box_pack_end(box, button);
+   evas_object_show(button);
 }
 
 EAPI_MAIN int
@@ -50,12 +346,16 @@ elm_main(int argc, char **argv)
 {
    Evas_Object *win;
 
-   win = eailu_create_test_window_with_glib_init(_on_done, _on_focus_in);
+   glob_win = win = eailu_create_test_window_with_glib_init(_on_done,
+                                                            _on_focus_in);
+   _initialize_window(win);
    evas_object_show(win);
 
    elm_run();
    elm_shutdown();
 
+   g_assert(3 == test_step);
+
    /* exit code */
    return 0;
 }